@@ -19,12 +19,17 @@
 
 #pragma once
 
+#include <chrono>
+#include <cstdint>
 #include <fstream>
 #include <string>
+#include <vector>
 
 #include "io/reader.hpp"
 #include "math/matrix.hpp"
 #include "tsp/algorithm/algorithm.hpp"
+#include "tsp/algorithm/ts.hpp"
+#include "utils/threadpool.hpp"
 
 class Application final
 {
@@ -35,6 +40,79 @@ public:
 public:
     void Start();
 
+private:
+    // The directory of the binary instances, unless another one is set in the settings
+    static constexpr const char* kCacheDirectory{ "cache" };
+
+    // The largest instance solved exactly, unless another limit is set for the test case
+    static constexpr size_t kExactCities{ 20 };
+
+private:
+    struct Result
+    {
+        std::chrono::microseconds duration;
+        int memory{};
+        tsp::algorithm::Algorithm::Solution solution;
+
+        // The seed of the run, which reproduces it
+        uint64_t seed{};
+    };
+
+private:
+    /**
+     * @brief Check whether the section describes an instance to solve
+     *
+     * @param section the section of the config
+     * @return true if the section is a test case
+     * @return false if the section configures the application itself
+     */
+    static bool IsTestCase(const io::Reader<io::FileTypes::kIni>::Parameters::Section& section);
+
+    /**
+     * @brief Get the amount of threads, which should solve the test cases
+     *
+     * @return size_t the amount of threads, zero means all the hardware threads
+     */
+    size_t GetThreadsCount() const;
+
+    /**
+     * @brief Get the seeds of the repeats of the test case
+     *
+     * @param section the section describing the test case
+     * @param section_index the number of the section, which is the default base seed
+     * @return std::vector<uint64_t> the seed of every repeat
+     * @throw std::runtime_error if the amount of the given seeds differs from the amount of the repeats
+     */
+    static std::vector<uint64_t> GetSeeds(const io::Reader<io::FileTypes::kIni>::Parameters::Section& section,
+                                          uint32_t section_index);
+
+    /**
+     * @brief Get the parameters of the solver from the section of the config
+     *
+     * @param section the section describing the test case
+     * @return tsp::algorithm::TS::Parameters the parameters of the solver
+     */
+    static tsp::algorithm::TS::Parameters GetSolverParameters(
+        const io::Reader<io::FileTypes::kIni>::Parameters::Section& section);
+
+    void WriteResult(const Result& result);
+
+    /**
+     * @brief Write the proven gap of the solution to the standard error, if the solver bounded it
+     *
+     * @param name the name of the test case
+     * @param repeat the index of the repeat
+     * @param solution the solution of the repeat
+     */
+    static void WriteBound(const std::string& name, size_t repeat, const tsp::algorithm::Algorithm::Solution& solution);
+
+    /**
+     * @brief Write how much of the time every worker spent on the runs to the standard error, apart from the results
+     *
+     * @param report the statistics of the workers of the pool
+     */
+    static void WriteUtilisation(const utils::ThreadPool::Report& report);
+
 private:
     io::Reader<io::FileTypes::kIni>::Parameters parameters_;
     std::ofstream output_file_;
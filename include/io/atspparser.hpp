@@ -0,0 +1,137 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "math/matrix.hpp"
+#include "math/point.hpp"
+#include "tsp/distances.hpp"
+
+namespace io
+{
+/**
+ * @brief Single-pass parser of the TSPLIB files, which is fed with the chunks of the file
+ *
+ * The explicit weights are written straight into the matrix and the coordinates of the cities into their list, the
+ * parser keeps only the current line of the specification and the token split between two chunks. The values may be
+ * separated by any whitespace, the section ends with the end of the file or with the next keyword (like EOF).
+ */
+class AtspParser
+{
+public:
+    enum class Format
+    {
+        kFullMatrix,
+        kUpperRow,
+        kLowerRow,
+        kUpperDiagRow,
+        kLowerDiagRow
+    };
+
+    /**
+     * @brief The instance given either by the explicit weights or by the coordinates of the cities
+     */
+    struct Instance
+    {
+        math::Matrix<uint32_t> weights;
+        std::vector<math::Point> points;
+
+        // The function of the distance between the points, not set for the explicit weights
+        std::optional<tsp::Metric> metric;
+    };
+
+public:
+    /**
+     * @brief Parse the next chunk of the file
+     *
+     * @param chunk the chunk, which may end in the middle of a line or of a token
+     */
+    void Feed(std::string_view chunk);
+
+    /**
+     * @brief Finish parsing after the last chunk
+     *
+     * @return Instance the weights or the coordinates of the instance
+     * @throw std::runtime_error if the file is incomplete
+     */
+    Instance Finish();
+
+    /**
+     * @brief Parse the name of the format of the weights
+     *
+     * @param name the value of EDGE_WEIGHT_FORMAT
+     * @return Format the format
+     */
+    static Format ParseFormat(std::string_view name);
+
+private:
+    void ProcessLine(std::string_view line);
+    void ProcessToken(std::string_view token);
+    void PrepareWeights();
+    void PrepareCoordinates();
+
+    bool IsSection() const noexcept
+    {
+        return stage_ == Stage::kWeights || stage_ == Stage::kCoordinates;
+    }
+
+    /**
+     * @brief Write the next weight into the position given by the format
+     *
+     * @param value the weight
+     */
+    void Put(uint32_t value);
+
+private:
+    enum class Stage
+    {
+        kSpecification,
+        kWeights,
+        kCoordinates,
+        kFinished
+    };
+
+    // The longest token, which may be split between two chunks
+    static constexpr size_t kMaxTokenSize{ 32 };
+
+private:
+    Stage stage_{ Stage::kSpecification };
+    Format format_{ Format::kFullMatrix };
+    uint32_t dimension_{};
+    Instance instance_;
+
+    // The current line of the specification or the beginning of the split token
+    std::string pending_;
+
+    // The amount of the values in the section and of the ones already read
+    size_t expected_{};
+    size_t count_{};
+
+    // The position of the next weight, the row is the number of the city in the coordinates section
+    uint32_t row_{};
+    uint32_t column_{};
+};
+} // namespace io
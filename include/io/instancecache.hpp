@@ -0,0 +1,116 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "io/reader.hpp"
+#include "tsp/distances.hpp"
+#include "utils/os/mappedfile.hpp"
+
+namespace io
+{
+/**
+ * @brief Loader of the instances, which keeps their compact distances in a binary format reused by the next runs
+ *
+ * A binary file starts with a header of one cache line: the magic, the dimension, the size of the stored values, the
+ * symmetric flag, the offset of the distances, the size and the hash of the source text file and the checksum of the
+ * values. The block of the values of the matrix follows in the byte order of the machine, which wrote it. The block is
+ * mapped straight into the matrix of the distances, so loading a binary file needs no parsing.
+ */
+class InstanceCache
+{
+public:
+    /**
+     * @brief Construct a new InstanceCache object
+     *
+     * @param directory the directory of the binary files, an empty path disables the cache
+     * @param neighbours the amount of the nearest neighbours of every city, whose distances are kept in the memory,
+     * when the distances are computed from the coordinates
+     */
+    explicit InstanceCache(std::filesystem::path directory, uint32_t neighbours = 0);
+
+public:
+    /**
+     * @brief Load the distances of the instance, every file is loaded only once by the cache
+     *
+     * A binary file is mapped directly. A text file is mapped from the cache, when the cached copy was made from the
+     * same content, otherwise it is parsed and stored in the cache. The instances given by the coordinates are parsed
+     * in linear time and never cached, their distances are computed on demand.
+     *
+     * @param file the path to the binary or the ATSP file
+     * @return std::shared_ptr<const tsp::Distances> the distances
+     */
+    std::shared_ptr<const tsp::Distances> Load(const std::string& file);
+
+    /**
+     * @brief Check whether the content is a binary instance
+     *
+     * @param content the content of the file
+     * @return true if the content starts with the header of the binary format
+     * @return false otherwise
+     */
+    static bool IsBinary(std::string_view content) noexcept;
+
+    /**
+     * @brief Map the distances of the binary instance, the mapped values are read-only
+     *
+     * @param file the mapped binary file, which is kept alive by the distances
+     * @return std::shared_ptr<const tsp::Distances> the distances
+     * @throw std::runtime_error if the file is truncated or its checksum does not match
+     */
+    static std::shared_ptr<const tsp::Distances> Read(std::shared_ptr<const utils::os::MappedFile> file);
+
+    /**
+     * @brief Write the distances in the binary format
+     *
+     * @param path the path to the binary file, which is replaced at once
+     * @param distances the distances stored in a matrix
+     * @param source the content of the text file, from which the distances were loaded
+     * @throw std::runtime_error if the distances are computed from the coordinates or the file cannot be written
+     */
+    static void Write(const std::filesystem::path& path, const tsp::Distances& distances, std::string_view source);
+
+private:
+    /**
+     * @brief Load the distances of the instance from the file or from its cached copy
+     *
+     * @param file the path to the binary or the ATSP file
+     * @return std::shared_ptr<const tsp::Distances> the distances
+     */
+    std::shared_ptr<const tsp::Distances> Open(const std::string& file) const;
+
+    std::filesystem::path GetCachePath(const std::string& file) const;
+
+    std::shared_ptr<const tsp::Distances> MakeDistances(io::Reader<io::FileTypes::kAtsp>::Parameters parameters) const;
+
+private:
+    std::filesystem::path directory_;
+    uint32_t neighbours_;
+
+    // The instances loaded during this run, which may be used by several sections
+    std::map<std::string, std::shared_ptr<const tsp::Distances>> loaded_;
+};
+} // namespace io
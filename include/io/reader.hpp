@@ -19,11 +19,16 @@
 
 #pragma once
 
+#include <algorithm>
+#include <fstream>
 #include <list>
 #include <map>
-#include <regex>
+#include <optional>
 #include <string>
+#include <string_view>
+#include <vector>
 
+#include "io/atspparser.hpp"
 #include "io/basereader.hpp"
 #include "math/matrix.hpp"
 #include "utils/tokenizer.hpp"
@@ -112,18 +117,35 @@ public:
 protected:
     std::pair<std::string, std::string> ProcessProperty(const std::string& value) const
     {
-        auto parsed_line = utils::Tokenizer::tokenize(value, '=');
-        if (parsed_line.size() != 2)
+        const utils::Tokenizer tokenizer{ value, '=' };
+        auto iterator = tokenizer.begin();
+        std::string_view tokens[2];
+        for (auto& token : tokens)
+        {
+            if (iterator == tokenizer.end())
+            {
+                throw std::runtime_error("Property is not defined properly.");
+            }
+            token = *iterator++;
+        }
+
+        if (iterator != tokenizer.end())
         {
             throw std::runtime_error("Property is not defined properly.");
         }
 
-        return { parsed_line.at(0), parsed_line.at(1) };
+        return { std::string{ tokens[0] }, std::string{ tokens[1] } };
     }
 
     bool IsSectionHeader(const std::string& value) const
     {
-        return std::regex_search(value, std::regex{ "^\[[a-zA-Z0-9]*\\]" });
+        if (value.empty() || value.front() != '[')
+        {
+            return false;
+        }
+
+        const auto end = value.find_first_not_of("abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789", 1);
+        return end != std::string::npos && value[end] == ']';
     }
 
     std::string ProcessSectionHeader(const std::string& value) const
@@ -132,7 +154,7 @@ protected:
     }
 };
 
-template <> class Reader<FileTypes::kAtsp> : public BaseReader
+template <> class Reader<FileTypes::kAtsp>
 {
 public:
     struct Parameters
@@ -140,113 +162,66 @@ public:
         // TODO
 
         math::Matrix<uint32_t> positions;
+
+        // The coordinates of the cities and the function of the distance, when the weights are not explicit
+        std::vector<math::Point> points;
+        std::optional<tsp::Metric> metric;
     };
 
 public:
-    Reader(const std::string& file) : BaseReader{ file }
+    Reader(const std::string& file) : file_{ file }
     {
     }
 
 public:
+    /**
+     * @brief Parse the file in a single pass, reading it in chunks of a constant size
+     *
+     * @return Parameters the parameters of the instance
+     */
     Parameters Read() const
     {
-        Parameters parameters;
-        Content content{ ReadRaw() };
-        uint32_t dimension;
-
-        for (const auto& line : content)
+        std::ifstream stream{ file_, std::ios::binary };
+        if (!stream.is_open())
         {
-            if (IsDimensionParameter(line))
-            {
-                dimension = GetDimensionParameter(line);
-            }
+            throw std::runtime_error("Could not open the file " + file_);
         }
 
-        parameters.positions = GetPositionsParameter(content, dimension);
-        if (parameters.positions.Columns() != dimension)
+        AtspParser parser;
+        std::vector<char> buffer(kChunkSize);
+        while (stream)
         {
-            std::cout << parameters.positions.Columns() << " " << dimension << std::endl;
-            throw std::runtime_error("Matrix from the given file is broken");
+            stream.read(buffer.data(), buffer.size());
+            parser.Feed({ buffer.data(), static_cast<size_t>(stream.gcount()) });
         }
 
-        return parameters;
+        return ToParameters(parser.Finish());
     }
 
-protected:
-    inline bool IsDimensionParameter(const std::string& value) const
+    /**
+     * @brief Parse the content of an ATSP file, which is already in the memory (e.g. mapped)
+     *
+     * @param content the whole content of the file
+     * @return Parameters the parameters of the instance
+     */
+    static Parameters Parse(std::string_view content)
     {
-        return value.rfind("DIMENSION: ", 0) == 0;
-    }
+        AtspParser parser;
+        parser.Feed(content);
 
-    inline bool IsEndOfFile(const std::string& value) const
-    {
-        return value.rfind("EOF", 0) == 0;
+        return ToParameters(parser.Finish());
     }
 
-    uint32_t GetDimensionParameter(const std::string& value) const
-    {
-        if (!IsDimensionParameter(value))
-        {
-            throw std::runtime_error("Passed value is not a dimension parameter");
-        }
-
-        const auto data = utils::Tokenizer::tokenize(value, ' ');
-        if (data.size() != 2)
-        {
-            throw std::runtime_error("Passed value is not a valid dimension parameter");
-        }
+private:
+    static constexpr size_t kChunkSize{ 64 * 1024 };
 
-        return std::stoi(data.at(1));
-    }
-
-    math::Matrix<uint32_t> GetPositionsParameter(Content& content, uint32_t dimensions) const
+private:
+    static Parameters ToParameters(AtspParser::Instance instance)
     {
-        math::Matrix<uint32_t> positions;
-
-        if (content.empty())
-        {
-            throw std::runtime_error("Content is empty. Was the file opened?");
-        }
-
-        auto iterator = std::find(content.begin(), content.end(), "EDGE_WEIGHT_SECTION");
-        if (iterator == content.end())
-        {
-            throw std::runtime_error("Positions matrix was not found");
-        }
-
-        ++iterator;
-        std::deque<uint32_t> weights;
-        std::deque<uint32_t> buffer;
-        for (; iterator != content.end(); ++iterator)
-        {
-            const auto line = *iterator;
-            if (IsEndOfFile(line))
-            {
-                break;
-            }
-
-            // Convert the parsed string to a row of matrix
-            const auto data = utils::Tokenizer::tokenize(line, ' ');
-            std::for_each(data.cbegin(), data.cend(), [&buffer, &weights, dimensions](const std::string& value) {
-                if (weights.size() < dimensions)
-                {
-                    weights.push_back(std::stoi(value));
-                }
-                else
-                {
-                    buffer.push_back(std::stoi(value));
-                }
-            });
-
-            if (weights.size() == dimensions)
-            {
-                positions.insert(weights);
-                weights = buffer;
-                weights.clear();
-            }
-        }
-
-        return positions;
+        return { std::move(instance.weights), std::move(instance.points), instance.metric };
     }
+
+private:
+    std::string file_;
 };
-} // namespace io
\ No newline at end of file
+} // namespace io
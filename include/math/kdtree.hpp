@@ -0,0 +1,113 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "math/point.hpp"
+
+namespace math
+{
+/**
+ * @brief Two-dimensional tree over a set of points, which finds the nearest ones to a query in logarithmic time
+ *
+ * The tree is built once, points may be removed from it afterwards to look for the nearest of the remaining ones. The
+ * nodes are kept implicitly in a single array of the indices of the points, which is split at the median of every
+ * range.
+ */
+class KdTree
+{
+public:
+    KdTree() = default;
+
+    /**
+     * @brief Build the tree over the points in O(n log n)
+     *
+     * @param points the points, whose indices are returned by the queries
+     */
+    explicit KdTree(std::span<const Point> points);
+
+public:
+    /**
+     * @brief Find the remaining points closest to the query, skipping the given one
+     *
+     * @param query the point of the query
+     * @param count the amount of the points to find
+     * @param skip the index of the point, which should not be returned (e.g. the query itself)
+     * @param result the indices of the points sorted by the distance, replaced by the found ones
+     */
+    void Nearest(const Point& query, uint32_t count, uint32_t skip, std::vector<uint32_t>& result) const;
+
+    /**
+     * @brief Find the remaining point closest to the query
+     *
+     * @param query the point of the query
+     * @return uint32_t the index of the point or Size() if no point remains
+     */
+    uint32_t Nearest(const Point& query) const;
+
+    /**
+     * @brief Remove the point from the results of the next queries
+     *
+     * @param point the index of the point
+     */
+    void Remove(uint32_t point);
+
+    size_t Size() const noexcept
+    {
+        return points_.size();
+    }
+
+private:
+    // The ranges up to this size are scanned linearly instead of being split
+    static constexpr uint32_t kLeafSize{ 8 };
+
+    // The found points, with the largest squared distance on the top of the heap
+    using Heap = std::vector<std::pair<double, uint32_t>>;
+
+private:
+    void Build(uint32_t begin, uint32_t end, uint32_t depth);
+    void Search(const Point& query, uint32_t count, uint32_t skip, uint32_t begin, uint32_t end, uint32_t depth,
+                Heap& heap) const;
+
+    /**
+     * @brief Get the position, at which the amount of the remaining points of the range is kept
+     */
+    static uint32_t GetKey(uint32_t begin, uint32_t end) noexcept
+    {
+        return end - begin <= kLeafSize ? begin : begin + (end - begin) / 2;
+    }
+
+private:
+    std::vector<Point> points_;
+
+    // The indices of the points in the order of the tree and the position of every point in that order
+    std::vector<uint32_t> order_;
+    std::vector<uint32_t> positions_;
+
+    // The amount of the remaining points of every range, kept at the position given by GetKey
+    std::vector<uint32_t> remaining_;
+    std::vector<bool> removed_;
+};
+} // namespace math
@@ -19,17 +19,34 @@
 
 #pragma once
 
-#include <deque>
+#include <cstdint>
 #include <iostream>
+#include <memory>
+#include <span>
 #include <stdexcept>
 #include <string>
+#include <utility>
+#include <vector>
+
+#include "utils/memory/alignedallocator.hpp"
 
 namespace math
 {
+/**
+ * @brief Dense matrix, which keeps all the values in a single cache-aligned row-major block
+ *
+ * The block is either owned by the matrix or borrowed from another object, like a mapped file, which is kept alive by
+ * the matrix and its copies.
+ *
+ * @tparam T the type of the values
+ */
 template <class T> class Matrix
 {
 private:
-    using Values = std::deque<std::deque<T>>;
+    using Values = std::vector<T, utils::memory::AlignedAllocator<T>>;
+
+public:
+    using value_type = T;
 
 public:
     Matrix() = default;
@@ -39,73 +56,165 @@ public:
         resize(columns, rows);
     }
 
-    Matrix(const Matrix<T>& rhs) : values_{ rhs.values_ }
+    /**
+     * @brief Construct a matrix over the values of another object without copying them
+     *
+     * @param columns the amount of the columns
+     * @param rows the amount of the rows
+     * @param values the block of StorageSize(columns, rows) values, which should stay valid as long as the owner
+     * @param owner the object keeping the values alive
+     */
+    Matrix(uint32_t columns, uint32_t rows, T* values, std::shared_ptr<const void> owner)
+        : owner_{ std::move(owner) }, values_{ values }, rows_{ rows }, columns_{ columns }
+    {
+    }
+
+    Matrix(const Matrix<T>& rhs)
+        : storage_{ rhs.storage_ }, owner_{ rhs.owner_ }, values_{ owner_ ? rhs.values_ : storage_.data() },
+          rows_{ rhs.rows_ }, columns_{ rhs.columns_ }
+    {
+    }
+
+    Matrix(Matrix<T>&& rhs) noexcept
+        : storage_{ std::move(rhs.storage_) }, owner_{ std::move(rhs.owner_) },
+          values_{ std::exchange(rhs.values_, nullptr) }, rows_{ std::exchange(rhs.rows_, 0) },
+          columns_{ std::exchange(rhs.columns_, 0) }
     {
     }
 
 public:
     Matrix& operator=(const Matrix<T>& rhs)
     {
-        values_ = rhs.values_;
+        return *this = Matrix<T>{ rhs };
+    }
+
+    Matrix& operator=(Matrix<T>&& rhs) noexcept
+    {
+        storage_ = std::move(rhs.storage_);
+        owner_ = std::move(rhs.owner_);
+        values_ = std::exchange(rhs.values_, nullptr);
+        rows_ = std::exchange(rhs.rows_, 0);
+        columns_ = std::exchange(rhs.columns_, 0);
         return *this;
     }
 
-    T& operator()(uint32_t row, uint32_t column)
+    /**
+     * @brief Get the value at the given position without checking the bounds
+     *
+     * @param row the index of the row
+     * @param column the index of the column
+     * @return T& the value
+     */
+    T& operator()(uint32_t row, uint32_t column) noexcept
+    {
+        return values_[static_cast<size_t>(row) * columns_ + column];
+    }
+
+    const T& operator()(uint32_t row, uint32_t column) const noexcept
     {
-        return const_cast<T&>(const_cast<const Matrix*>(this)->operator()(column, row));
+        return values_[static_cast<size_t>(row) * columns_ + column];
     }
 
-    const T& operator()(uint32_t row, uint32_t column) const
+    /**
+     * @brief Get the row at the given index without checking the bounds
+     *
+     * @param row the index of the row
+     * @return std::span<T> the values of the row
+     */
+    std::span<T> operator[](uint32_t row) noexcept
+    {
+        return { values_ + static_cast<size_t>(row) * columns_, columns_ };
+    }
+
+    std::span<const T> operator[](uint32_t row) const noexcept
+    {
+        return { values_ + static_cast<size_t>(row) * columns_, columns_ };
+    }
+
+    /**
+     * @brief Get the value at the given position
+     *
+     * @param row the index of the row
+     * @param column the index of the column
+     * @return T& the value
+     * @throw std::out_of_range if the position is outside of the matrix
+     */
+    T& at(uint32_t row, uint32_t column)
+    {
+        return const_cast<T&>(const_cast<const Matrix*>(this)->at(row, column));
+    }
+
+    const T& at(uint32_t row, uint32_t column) const
     {
         if (column >= Columns() || row >= Rows())
         {
-            throw std::runtime_error("Size of the matrix is smaller than the provided position");
+            throw std::out_of_range("Size of the matrix is smaller than the provided position");
         }
 
-        const auto& matrix_row = values_.at(row);
-        return matrix_row.at(column);
+        return operator()(row, column);
     }
 
-    size_t Rows() const
+    T* data() noexcept
     {
-        return values_.size();
+        return values_;
     }
 
-    size_t Columns() const
+    const T* data() const noexcept
     {
-        return Rows() == 0 ? 0 : values_.at(0).size();
+        return values_;
     }
 
-    void resize(uint32_t columns, uint32_t rows)
+    size_t Rows() const noexcept
     {
-        // TODO : add checks
+        return rows_;
+    }
 
-        // Construct rows of the matrix
-        for (uint32_t row{}; row < rows; ++row)
-        {
-            values_.emplace_back(columns);
-        }
+    size_t Columns() const noexcept
+    {
+        return columns_;
     }
 
-    void insert(const std::deque<T>& value)
+    void resize(uint32_t columns, uint32_t rows)
     {
-        // TODO : add a check
+        storage_.assign(StorageSize(columns, rows), T{});
+        owner_.reset();
+        values_ = storage_.data();
+        rows_ = rows;
+        columns_ = columns;
+    }
 
-        values_.push_back(value);
+    /**
+     * @brief Get the amount of the values in the block of a matrix, including the padding after the last row
+     *
+     * @param columns the amount of the columns
+     * @param rows the amount of the rows
+     * @return size_t the amount of the values
+     */
+    static size_t StorageSize(uint32_t columns, uint32_t rows) noexcept
+    {
+        return static_cast<size_t>(columns) * rows + kPadding;
     }
 
-    const std::deque<T>& GetRow(uint32_t index) const
+    std::span<const T> GetRow(uint32_t index) const
     {
         if (index >= Rows())
         {
-            throw std::runtime_error("Size of the matrix is smaller than the provided index of the row");
+            throw std::out_of_range("Size of the matrix is smaller than the provided index of the row");
         }
 
-        return values_.at(index);
+        return operator[](index);
     }
 
 private:
-    Values values_;
+    // The vectorised gathers load 32-bit words, so the last value of a narrow type is followed by a padding
+    static constexpr size_t kPadding{ sizeof(uint32_t) / sizeof(T) };
+
+private:
+    Values storage_;
+    std::shared_ptr<const void> owner_;
+    T* values_{};
+    uint32_t rows_{};
+    uint32_t columns_{};
 };
 } // namespace math
 
@@ -115,10 +224,10 @@ template <class T> std::ostream& operator<<(std::ostream& stream, const math::Ma
     {
         for (uint32_t column{}; column < matrix.Columns(); ++column)
         {
-            std::cout << matrix(column, row);
+            stream << matrix(row, column) << " ";
         }
-        std::cout << std::endl;
+        stream << std::endl;
     }
 
     return stream;
-}
\ No newline at end of file
+}
@@ -0,0 +1,191 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "utils/memory/alignedallocator.hpp"
+
+namespace math
+{
+/**
+ * @brief Symmetric square matrix, which keeps only the lower triangle (with the diagonal) in a single cache-aligned
+ * block
+ *
+ * Like the dense matrix, the block may be borrowed from another object, which is kept alive by the matrix.
+ *
+ * @tparam T the type of the values
+ */
+template <class T> class TriangularMatrix
+{
+private:
+    using Values = std::vector<T, utils::memory::AlignedAllocator<T>>;
+
+public:
+    using value_type = T;
+
+public:
+    TriangularMatrix() = default;
+
+    explicit TriangularMatrix(uint32_t size)
+    {
+        resize(size);
+    }
+
+    /**
+     * @brief Construct a matrix over the values of another object without copying them
+     *
+     * @param size the amount of the rows and the columns
+     * @param values the block of StorageSize(size) values, which should stay valid as long as the owner
+     * @param owner the object keeping the values alive
+     */
+    TriangularMatrix(uint32_t size, T* values, std::shared_ptr<const void> owner)
+        : owner_{ std::move(owner) }, values_{ values }, size_{ size }
+    {
+    }
+
+    TriangularMatrix(const TriangularMatrix<T>& rhs)
+        : storage_{ rhs.storage_ }, owner_{ rhs.owner_ }, values_{ owner_ ? rhs.values_ : storage_.data() },
+          size_{ rhs.size_ }
+    {
+    }
+
+    TriangularMatrix(TriangularMatrix<T>&& rhs) noexcept
+        : storage_{ std::move(rhs.storage_) }, owner_{ std::move(rhs.owner_) },
+          values_{ std::exchange(rhs.values_, nullptr) }, size_{ std::exchange(rhs.size_, 0) }
+    {
+    }
+
+public:
+    TriangularMatrix& operator=(const TriangularMatrix<T>& rhs)
+    {
+        return *this = TriangularMatrix<T>{ rhs };
+    }
+
+    TriangularMatrix& operator=(TriangularMatrix<T>&& rhs) noexcept
+    {
+        storage_ = std::move(rhs.storage_);
+        owner_ = std::move(rhs.owner_);
+        values_ = std::exchange(rhs.values_, nullptr);
+        size_ = std::exchange(rhs.size_, 0);
+        return *this;
+    }
+
+    /**
+     * @brief Get the value at the given position without checking the bounds, the order of the indices is irrelevant
+     *
+     * @param row the index of the row
+     * @param column the index of the column
+     * @return T& the value
+     */
+    T& operator()(uint32_t row, uint32_t column) noexcept
+    {
+        return values_[Index(row, column)];
+    }
+
+    const T& operator()(uint32_t row, uint32_t column) const noexcept
+    {
+        return values_[Index(row, column)];
+    }
+
+    /**
+     * @brief Get the value at the given position
+     *
+     * @param row the index of the row
+     * @param column the index of the column
+     * @return T& the value
+     * @throw std::out_of_range if the position is outside of the matrix
+     */
+    T& at(uint32_t row, uint32_t column)
+    {
+        return const_cast<T&>(const_cast<const TriangularMatrix*>(this)->at(row, column));
+    }
+
+    const T& at(uint32_t row, uint32_t column) const
+    {
+        if (column >= size_ || row >= size_)
+        {
+            throw std::out_of_range("Size of the matrix is smaller than the provided position");
+        }
+
+        return operator()(row, column);
+    }
+
+    T* data() noexcept
+    {
+        return values_;
+    }
+
+    const T* data() const noexcept
+    {
+        return values_;
+    }
+
+    size_t Rows() const noexcept
+    {
+        return size_;
+    }
+
+    size_t Columns() const noexcept
+    {
+        return size_;
+    }
+
+    void resize(uint32_t size)
+    {
+        storage_.assign(StorageSize(size), T{});
+        owner_.reset();
+        values_ = storage_.data();
+        size_ = size;
+    }
+
+    /**
+     * @brief Get the amount of the values in the block of a matrix
+     *
+     * @param size the amount of the rows and the columns
+     * @return size_t the amount of the values
+     */
+    static size_t StorageSize(uint32_t size) noexcept
+    {
+        return static_cast<size_t>(size) * (size + 1) / 2;
+    }
+
+private:
+    static size_t Index(uint32_t row, uint32_t column) noexcept
+    {
+        if (row < column)
+        {
+            std::swap(row, column);
+        }
+
+        return static_cast<size_t>(row) * (row + 1) / 2 + column;
+    }
+
+private:
+    Values storage_;
+    std::shared_ptr<const void> owner_;
+    T* values_{};
+    uint32_t size_{};
+};
+} // namespace math
@@ -19,33 +19,33 @@
 
 #pragma once
 
-#include <deque>
-#include <limits>
+#include <cstdint>
+#include <optional>
 
-#include "math/matrix.hpp"
+#include "tsp/tour.hpp"
 
 namespace tsp::algorithm
 {
 class Algorithm
 {
 public:
-    using Path = std::deque<uint32_t>;
+    using Path = tsp::Tour;
 
     struct Solution
     {
         Path path;
         uint32_t weight{};
 
+        // The proven lower bound of the weight of every tour, if the solver gives one
+        std::optional<uint32_t> bound;
+
         bool operator<(const Solution& another);
     };
 
 public:
-    Algorithm(math::Matrix<uint32_t> distances);
+    virtual ~Algorithm() = default;
 
 public:
     virtual Solution Solve() = 0;
-
-protected:
-    math::Matrix<uint32_t> distances_;
 };
 } // namespace tsp::algorithm
\ No newline at end of file
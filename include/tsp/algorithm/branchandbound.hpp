@@ -0,0 +1,234 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "tsp/algorithm/algorithm.hpp"
+#include "tsp/algorithm/ts.hpp"
+#include "tsp/distances.hpp"
+#include "utils/memory/blockpool.hpp"
+#include "utils/workergroup.hpp"
+
+namespace tsp::algorithm
+{
+/**
+ * @brief The order, in which the branch and bound expands the open nodes
+ */
+enum class Order
+{
+    // The node of the smallest lower bound, which expands the fewest nodes, but keeps the widest frontier
+    kBestFirst,
+
+    // The most recently created node, which keeps the frontier small and improves the upper bound early
+    kDepthFirst
+};
+
+/**
+ * @brief Parse the name of the order of the nodes
+ *
+ * @param name the name used by the configuration (best or depth)
+ * @return Order the order
+ * @throw std::runtime_error if the name is unknown
+ */
+Order ParseOrder(const std::string& name);
+
+/**
+ * @brief Exact solver of the asymmetric instances of a moderate size by the branch and bound over the assignment
+ * problem relaxation
+ *
+ * The relaxation of every node is the assignment problem, whose optimum may consist of several subtours. A node is
+ * split by the shortest of them in the way of Carpaneto and Toth: the k-th child excludes the k-th free arc of the
+ * subtour and includes the ones before it, so the children are disjoint. As a child differs from its parent only by
+ * the raised costs, it keeps the dual variables and the assignment of the parent and restores the optimum by a single
+ * augmenting path per removed arc in O(n^2) instead of solving in O(n^3). The tabu search gives the starting upper
+ * bound, the nodes live in a pool of the blocks of the same size and the workers expand the nodes of the shared
+ * frontier in parallel. When the time limit or the memory for the nodes runs out, the smallest bound of the frontier
+ * is the proven lower bound of the returned solution.
+ */
+class BranchAndBound : public Algorithm
+{
+public:
+    // The largest instance, whose nodes still fit a few kilobytes
+    static constexpr size_t kMaxCities{ 128 };
+
+    // The share of the time limit given to the tabu search finding the starting upper bound
+    static constexpr uint32_t kSearchShare{ 8 };
+
+public:
+    /**
+     * @brief Construct a new BranchAndBound object
+     *
+     * @param distances the distances between cities
+     * @param parameters the parameters of the tabu search, whose time limit and threads also limit the branching
+     * @param order the order of the expanded nodes
+     * @throw std::runtime_error if the instance has more than kMaxCities cities
+     */
+    BranchAndBound(std::shared_ptr<const tsp::Distances> distances, const TS::Parameters& parameters,
+                   Order order = Order::kBestFirst);
+
+public:
+    /**
+     * @brief Find the optimal tour or the best one within the time limit
+     *
+     * @return Solution the best solution with the proven lower bound of the weight of any tour
+     */
+    Solution Solve() override;
+
+private:
+    // The fixed part of a node, which is followed by its arrays in the same block
+    struct Node
+    {
+        int64_t bound;
+        uint32_t depth;
+    };
+
+    // The arrays of a node, the assignment and the potentials are indexed from one as in the Hungarian method
+    struct View
+    {
+        Node* node;
+
+        // The potentials of the rows (the cities left) and of the columns (the cities entered)
+        int64_t* rows;
+        int64_t* columns;
+
+        // The row assigned to every column
+        int32_t* assigned;
+
+        // The arcs forced into the tour, by their ends, or -1
+        int16_t* successors;
+        int16_t* predecessors;
+
+        // The arcs forbidden in the tour, one bit per arc
+        uint64_t* excluded;
+    };
+
+private:
+    View GetView(void* block) const noexcept;
+
+    void* Allocate();
+    void Release(Node* node) noexcept;
+
+    /**
+     * @brief Get the cost of the arc in the relaxation of the node, the forbidden arcs cost kInfinity
+     *
+     * @param view the node
+     * @param from the city left, from zero
+     * @param to the city entered, from zero
+     * @return int64_t the cost of the arc
+     */
+    int64_t GetCost(const View& view, uint32_t from, uint32_t to) const noexcept;
+
+    /**
+     * @brief Assign the free row by the shortest augmenting path, which keeps the potentials feasible
+     *
+     * @param view the node, whose costs only grew since the potentials were optimal
+     * @param row the free row, from one
+     */
+    void Augment(const View& view, uint32_t row) const;
+
+    /**
+     * @brief Forbid the arc and free its row if it was assigned
+     *
+     * @param view the node
+     * @param from the city left, from zero
+     * @param to the city entered, from zero
+     * @return true if the row of the arc has to be assigned again
+     */
+    bool Exclude(const View& view, uint32_t from, uint32_t to) const noexcept;
+
+    /**
+     * @brief Get the successor of every city in the assignment of the node
+     *
+     * @param view the node
+     * @param successors the successors, from zero
+     * @return size_t the amount of the cycles of the assignment
+     */
+    size_t GetSuccessors(const View& view, std::vector<uint32_t>& successors) const;
+
+    /**
+     * @brief Split the node into its children and keep the ones, which may still improve the upper bound
+     *
+     * @param view the node, which is not a tour
+     * @param children the pushed children
+     */
+    void Branch(const View& view, std::vector<Node*>& children);
+
+    /**
+     * @brief Keep the tour of the node, if it is shorter than the best one
+     *
+     * @param view the node, whose assignment is a single cycle
+     * @param successors the successor of every city in the assignment
+     */
+    void Offer(const View& view, const std::vector<uint32_t>& successors);
+
+    void Work();
+
+    void Push(Node* node);
+    Node* Pop();
+
+private:
+    // The cost of the forbidden arcs, which is larger than any tour, but cannot overflow in the sum of n of them
+    static constexpr int64_t kInfinity{ int64_t{ 1 } << 40 };
+
+    // The memory, which the open nodes may take, before the search stops with the bound of the frontier
+    static constexpr size_t kMaxMemory{ size_t{ 1 } << 30 };
+
+private:
+    const uint32_t kCities;
+    const Order kOrder;
+    std::shared_ptr<const tsp::Distances> distances_;
+    std::vector<uint32_t> costs_;
+    TS::Parameters parameters_;
+
+    // The offsets of the arrays in the block of a node
+    size_t rows_offset_{};
+    size_t columns_offset_{};
+    size_t assigned_offset_{};
+    size_t successors_offset_{};
+    size_t predecessors_offset_{};
+    size_t excluded_offset_{};
+    size_t excluded_words_{};
+
+    utils::memory::BlockPool pool_;
+    size_t max_nodes_{};
+    std::unique_ptr<utils::WorkerGroup> workers_;
+
+    // The frontier, which is a heap by the bounds for the best-first order and a stack for the depth-first one
+    std::mutex mutex_;
+    std::condition_variable changed_;
+    std::vector<Node*> open_;
+    size_t busy_{};
+    bool stopped_{};
+    std::chrono::steady_clock::time_point end_;
+
+    // The best tour, whose weight is also read without the lock to prune the nodes
+    std::atomic<int64_t> upper_bound_{};
+    std::mutex best_mutex_;
+    Solution best_;
+};
+} // namespace tsp::algorithm
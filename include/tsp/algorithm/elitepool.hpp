@@ -0,0 +1,73 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+
+#include "tsp/algorithm/algorithm.hpp"
+#include "tsp/algorithm/eliteset.hpp"
+#include "utils/random.hpp"
+
+namespace tsp::algorithm
+{
+/**
+ * @brief The elite solutions shared by the islands of the cooperative search
+ *
+ * The islands publish their solutions only every few iterations and sample the pool only on a restart, so a short
+ * lock is enough. A solution, which would not enter the pool, is rejected without the lock.
+ */
+class ElitePool
+{
+public:
+    /**
+     * @brief Construct a new ElitePool object
+     *
+     * @param capacity the largest amount of the kept solutions
+     */
+    explicit ElitePool(size_t capacity);
+
+public:
+    /**
+     * @brief Offer the solution of an island to the pool
+     *
+     * @param solution the solution
+     */
+    void Publish(const Algorithm::Solution& solution);
+
+    /**
+     * @brief Copy a random solution of the pool
+     *
+     * @param random the generator of the island choosing the solution
+     * @return std::optional<Algorithm::Solution> the solution, none if the pool is empty
+     */
+    std::optional<Algorithm::Solution> Sample(utils::Random& random) const;
+
+private:
+    mutable std::mutex mutex_;
+    EliteSet elite_;
+
+    // The weight, below which a solution may enter the pool, read without the lock
+    std::atomic<uint32_t> threshold_;
+};
+} // namespace tsp::algorithm
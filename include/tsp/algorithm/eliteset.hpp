@@ -0,0 +1,85 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "tsp/algorithm/algorithm.hpp"
+
+namespace tsp::algorithm
+{
+/**
+ * @brief The best distinct solutions sorted by the weight, the tours visiting the cities in the same cyclic order are
+ * the same solution
+ */
+class EliteSet
+{
+public:
+    /**
+     * @brief Construct a new EliteSet object
+     *
+     * @param capacity the largest amount of the kept solutions
+     */
+    explicit EliteSet(size_t capacity);
+
+public:
+    /**
+     * @brief Keep the solution if it is better than the worst kept one and differs from all of them
+     *
+     * @param solution the solution
+     * @return true if the solution was kept
+     * @return false otherwise
+     */
+    bool Offer(const Algorithm::Solution& solution);
+
+    /**
+     * @brief Get the weight, below which a solution may be kept
+     *
+     * @return uint32_t the weight of the worst kept solution or the largest weight when there is still place
+     */
+    uint32_t GetThreshold() const noexcept
+    {
+        return solutions_.size() < kCapacity ? std::numeric_limits<uint32_t>::max() : solutions_.back().weight;
+    }
+
+    const Algorithm::Solution& operator[](size_t index) const noexcept
+    {
+        return solutions_[index];
+    }
+
+    size_t size() const noexcept
+    {
+        return solutions_.size();
+    }
+
+    bool empty() const noexcept
+    {
+        return solutions_.empty();
+    }
+
+private:
+    const size_t kCapacity;
+
+    std::vector<Algorithm::Solution> solutions_;
+};
+} // namespace tsp::algorithm
@@ -0,0 +1,94 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "tsp/algorithm/algorithm.hpp"
+#include "tsp/distances.hpp"
+#include "utils/workergroup.hpp"
+
+namespace tsp::algorithm
+{
+/**
+ * @brief Exact solver of the small instances by the Held-Karp dynamic programming in O(2^n * n^2)
+ *
+ * The table keeps for every subset of the cities and every city of the subset the weight of the shortest path, which
+ * starts at the first city, visits the subset and ends at the given city. The values are kept in the narrowest type,
+ * which fits the longest tour, the subsets of the same size are computed in parallel and the minimum over the
+ * predecessors is vectorised.
+ */
+class HeldKarp : public Algorithm
+{
+public:
+    // The largest instance, whose table of 32-bit values still takes less than kMaxTableSize
+    static constexpr size_t kMaxCities{ 24 };
+
+    // The memory taken by the table, which keeps a value for every subset of the other cities and its last city
+    static constexpr size_t kMaxTableSize{ size_t{ 1 } << 30 };
+    static_assert((size_t{ 1 } << (kMaxCities - 1)) * (kMaxCities - 1) * sizeof(uint32_t) < kMaxTableSize);
+
+public:
+    /**
+     * @brief Construct a new HeldKarp object
+     *
+     * @param distances the distances between cities
+     * @param threads the amount of threads computing the table, zero means the amount of hardware threads
+     * @throw std::runtime_error if the instance has more than kMaxCities cities
+     */
+    HeldKarp(std::shared_ptr<const tsp::Distances> distances, size_t threads = 1);
+
+public:
+    /**
+     * @brief Find the optimal tour
+     *
+     * @return Solution the optimal solution
+     * @throw std::runtime_error if the weight of a tour could not be represented
+     */
+    Solution Solve() override;
+
+private:
+    /**
+     * @brief Fill the table of the given type and rebuild the optimal tour from it
+     *
+     * @tparam T the type of the values, which fits twice the weight of any tour
+     * @return Solution the optimal solution
+     */
+    template <class T> Solution Solve();
+
+    uint32_t GetDistance(uint32_t from, uint32_t to) const noexcept
+    {
+        return distances_[from * kCities + to];
+    }
+
+private:
+    // The amount of the consecutive subsets of the same size computed by a single worker at a time
+    static constexpr size_t kChunkSize{ 1024 };
+
+private:
+    const uint32_t kCities;
+    std::vector<uint32_t> distances_;
+
+    std::unique_ptr<utils::WorkerGroup> workers_;
+};
+} // namespace tsp::algorithm
@@ -0,0 +1,76 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <optional>
+
+#include "tsp/algorithm/algorithm.hpp"
+#include "tsp/algorithm/ts.hpp"
+#include "utils/workergroup.hpp"
+
+namespace tsp::algorithm
+{
+/**
+ * @brief Cooperative tabu search, whose islands run in parallel and share the elite solutions
+ *
+ * Every island is a separate search with its own random generator. The islands publish their best solutions to the
+ * shared pool and adopt or recombine the solutions of the others on their restarts. With a scheduler the islands are
+ * its sub-tasks, which the idle workers steal, and an island started late gets only the rest of the time limit.
+ */
+class Islands : public Algorithm
+{
+public:
+    /**
+     * @brief Construct a new Islands object
+     *
+     * @param distances the distances between cities, which are shared read-only between the islands
+     * @param parameters the parameters of every island, the seeds of the islands are derived from the given one
+     */
+    Islands(std::shared_ptr<const tsp::Distances> distances, const TS::Parameters& parameters);
+
+public:
+    /**
+     * @brief Solve the given problem on all the islands
+     *
+     * @return Solution the best solution of all the islands
+     */
+    Solution Solve() override;
+
+private:
+    /**
+     * @brief Solve the problem on a single island
+     *
+     * @param island the index of the island
+     * @param start the start of the whole search
+     * @return std::optional<Solution> the solution, none if the island started after the time limit
+     */
+    std::optional<Solution> SolveIsland(size_t island, std::chrono::steady_clock::time_point start) const;
+
+private:
+    std::shared_ptr<const tsp::Distances> distances_;
+    TS::Parameters parameters_;
+    size_t count_;
+
+    std::unique_ptr<utils::WorkerGroup> workers_;
+};
+} // namespace tsp::algorithm
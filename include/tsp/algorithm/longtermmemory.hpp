@@ -0,0 +1,177 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+#include "math/matrix.hpp"
+#include "tsp/algorithm/algorithm.hpp"
+#include "tsp/algorithm/eliteset.hpp"
+#include "tsp/candidatelist.hpp"
+#include "tsp/tour.hpp"
+#include "utils/random.hpp"
+
+namespace tsp::algorithm
+{
+/**
+ * @brief The way, in which the tabu search starts a new epoch
+ */
+enum class Restart
+{
+    // A uniformly random tour, which forgets everything found so far
+    kRandom,
+
+    // A tour built from the edges, which were rarely part of the visited solutions
+    kFrequency,
+
+    // A tour on the path between two elite solutions, alternated with the frequency-based restarts
+    kElite
+};
+
+/**
+ * @brief Parse the name of the restart strategy
+ *
+ * @param name the name used by the configuration (random, frequency or elite)
+ * @return Restart the strategy
+ * @throw std::runtime_error if the name is unknown
+ */
+Restart ParseRestart(const std::string& name);
+
+/**
+ * @brief Long-term memory of the tabu search, which keeps the frequencies of the edges in the visited solutions and
+ * the best solutions of the past epochs
+ *
+ * The frequencies drive the diversification towards the edges, which were rarely visited, while the elite solutions
+ * are the ends of the path relinking. The large instances keep only the frequencies of the visited edges, as the matrix
+ * of all the pairs would not fit the memory.
+ */
+class LongTermMemory
+{
+public:
+    /**
+     * @brief Construct a new LongTermMemory object
+     *
+     * @param cities the amount of cities in the problem
+     * @param elite the largest amount of the kept elite solutions
+     */
+    LongTermMemory(uint32_t cities, size_t elite);
+
+public:
+    /**
+     * @brief Register the current solution of an iteration
+     *
+     * Its edges are counted only every few iterations, so the cost stays O(1) per iteration on average.
+     *
+     * @param tour the current tour
+     */
+    void Visit(const Tour& tour);
+
+    /**
+     * @brief Offer the best solution of an epoch to the elite, which keeps the best distinct solutions
+     *
+     * @param solution the solution
+     */
+    void Offer(const Algorithm::Solution& solution);
+
+    /**
+     * @brief Build a tour by the nearest neighbour heuristic, which penalises the frequently visited edges
+     *
+     * @tparam Distances the representation of the distances
+     * @param distances the distances between cities
+     * @param candidates the nearest neighbours checked first, nullptr checks all the unvisited cities
+     * @param random the generator choosing the first city
+     * @return Tour the tour over all the cities
+     */
+    template <class Distances>
+    Tour Diversify(const Distances& distances, const CandidateList* candidates, utils::Random& random) const;
+
+    /**
+     * @brief Walk by swaps from one elite solution to another and take the best solution between them
+     *
+     * @tparam Distances the representation of the distances
+     * @param distances the distances between cities
+     * @param random the generator choosing the elite solutions
+     * @return std::optional<Algorithm::Solution> the solution, none if there are no two different elite solutions
+     */
+    template <class Distances>
+    std::optional<Algorithm::Solution> Relink(const Distances& distances, utils::Random& random) const;
+
+    /**
+     * @brief Get the amount of the samples, in which the edge was present
+     *
+     * @param first the first city of the edge
+     * @param second the second city of the edge
+     * @return uint32_t the frequency of the edge
+     */
+    uint32_t GetFrequency(uint32_t first, uint32_t second) const noexcept
+    {
+        if (!IsSparse())
+        {
+            return frequencies_(first, second);
+        }
+
+        const auto iterator = sparse_frequencies_.find(GetKey(first, second));
+        return iterator == sparse_frequencies_.end() ? 0 : iterator->second;
+    }
+
+    const EliteSet& GetElite() const noexcept
+    {
+        return elite_;
+    }
+
+private:
+    bool IsSparse() const noexcept
+    {
+        return frequencies_.Rows() == 0;
+    }
+
+    static uint64_t GetKey(uint32_t first, uint32_t second) noexcept
+    {
+        return first < second ? (static_cast<uint64_t>(first) << 32) | second
+                              : (static_cast<uint64_t>(second) << 32) | first;
+    }
+
+private:
+    // The largest instance, for which the frequencies of all the pairs are kept (16 MiB)
+    static constexpr uint32_t kMaxDenseCities{ 2048 };
+
+    // The amount of the edges counted per iteration on average
+    static constexpr uint32_t kEdgesPerIteration{ 16 };
+
+    // The weight of an edge present in every sample is multiplied by 1 + kPenalty
+    static constexpr double kPenalty{ 1.0 };
+
+private:
+    const uint32_t kCities;
+    const uint32_t kSampleInterval;
+
+    uint32_t iteration_{};
+    uint32_t samples_{};
+
+    math::Matrix<uint32_t> frequencies_;
+    std::unordered_map<uint64_t, uint32_t> sparse_frequencies_;
+
+    EliteSet elite_;
+};
+} // namespace tsp::algorithm
@@ -0,0 +1,105 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+
+namespace tsp::algorithm
+{
+/**
+ * @brief Memory of the reactive tabu search, which adapts the tenure to the cycles of the search
+ *
+ * The hashes of the visited solutions are remembered with the iteration of the last visit. Returning to a solution
+ * after a short cycle grows the tenure, while a long time without any return shrinks it. When solutions repeat too
+ * often, the search is trapped in a region despite the tenure and should escape from it.
+ */
+class ReactiveMemory
+{
+public:
+    /**
+     * @brief Construct a new ReactiveMemory object
+     *
+     * @param cities the amount of cities in the problem
+     * @param tenure the starting tenure
+     */
+    ReactiveMemory(uint32_t cities, uint32_t tenure);
+
+public:
+    /**
+     * @brief Register the solution reached by the last move and react to a repetition
+     *
+     * @param hash the hash of the solution
+     * @return true if the search should escape with random moves
+     * @return false otherwise
+     */
+    bool Visit(uint64_t hash);
+
+    /**
+     * @brief Forget the visited solutions, e.g. after the search restarted from another solution
+     */
+    void Clear();
+
+    uint32_t GetTenure() const noexcept
+    {
+        return tenure_;
+    }
+
+    /**
+     * @brief Get the amount of the random moves of an escape, which grows with the mean length of the cycles
+     *
+     * @return uint32_t the amount of the moves
+     */
+    uint32_t GetEscapeLength() const noexcept;
+
+private:
+    struct Entry
+    {
+        uint32_t iteration;
+        uint32_t repetitions;
+    };
+
+    // The factors of the changes of the tenure
+    static constexpr double kIncrease{ 1.1 };
+    static constexpr double kDecrease{ 0.9 };
+
+    // A solution visited more often is a sign of trapping, more such solutions trigger an escape
+    static constexpr uint32_t kRepetitions{ 3 };
+    static constexpr uint32_t kChaotic{ 3 };
+
+    // The visited solutions are forgotten above this amount to bound the memory
+    static constexpr size_t kMaxVisited{ 1U << 20 };
+
+private:
+    const uint32_t kCities;
+    const uint32_t kMaxTenure;
+
+    uint32_t tenure_;
+    uint32_t iteration_{};
+    uint32_t last_change_{};
+    uint32_t chaotic_{};
+
+    // The moving average of the lengths of the cycles
+    double average_cycle_{ 1.0 };
+
+    std::unordered_map<uint64_t, Entry> visited_;
+};
+} // namespace tsp::algorithm
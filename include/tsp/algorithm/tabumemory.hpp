@@ -0,0 +1,147 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+
+#include "math/matrix.hpp"
+
+namespace tsp::algorithm
+{
+/**
+ * @brief Short-term memory of the tabu search, which keeps for every pair of cities the iteration until which a move
+ * touching this pair is forbidden
+ *
+ * The large instances keep only the recently forbidden pairs, as the matrix of all the pairs would not fit the memory.
+ */
+class TabuMemory
+{
+public:
+    /**
+     * @brief Construct a new TabuMemory object
+     *
+     * @param cities the amount of cities in the problem
+     * @param tenure the amount of iterations, for which a move stays forbidden
+     */
+    TabuMemory(uint32_t cities, uint32_t tenure);
+
+public:
+    /**
+     * @brief Check whether the move touching the given pair of cities is forbidden
+     *
+     * @param first the first city
+     * @param second the second city
+     * @return true if the move is forbidden
+     * @return false otherwise
+     */
+    bool IsTabu(uint32_t first, uint32_t second) const noexcept
+    {
+        if (!IsSparse())
+        {
+            return expirations_(first, second) > iteration_;
+        }
+
+        const auto iterator = sparse_expirations_.find(GetKey(first, second));
+        return iterator != sparse_expirations_.end() && iterator->second > iteration_;
+    }
+
+    /**
+     * @brief Forbid the moves touching the given pair of cities for the tenure
+     *
+     * @param first the first city
+     * @param second the second city
+     */
+    void Add(uint32_t first, uint32_t second)
+    {
+        const auto expiration = iteration_ + tenure_;
+        horizon_ = std::max(horizon_, expiration);
+        if (IsSparse())
+        {
+            sparse_expirations_[GetKey(first, second)] = expiration;
+            return;
+        }
+
+        expirations_(first, second) = expiration;
+        expirations_(second, first) = expiration;
+    }
+
+    /**
+     * @brief Move to the next iteration, which may release the expired moves
+     */
+    void Advance();
+
+    /**
+     * @brief Release all the forbidden moves, which takes O(1) as the iterations skip past every expiration
+     */
+    void Clear();
+
+    uint32_t GetTenure() const noexcept
+    {
+        return tenure_;
+    }
+
+    /**
+     * @brief Change the tenure of the moves forbidden from now on, the already forbidden ones keep their expiration
+     *
+     * @param tenure the amount of iterations, for which a move stays forbidden
+     */
+    void SetTenure(uint32_t tenure) noexcept
+    {
+        tenure_ = tenure;
+    }
+
+private:
+    bool IsSparse() const noexcept
+    {
+        return expirations_.Rows() == 0;
+    }
+
+    static uint64_t GetKey(uint32_t first, uint32_t second) noexcept
+    {
+        return first < second ? (static_cast<uint64_t>(first) << 32) | second
+                              : (static_cast<uint64_t>(second) << 32) | first;
+    }
+
+private:
+    /**
+     * @brief Erase all the expirations and start counting the iterations over, before they could overflow
+     */
+    void Reset();
+
+private:
+    // The largest instance, for which the expirations of all the pairs are kept (4 MiB per search)
+    static constexpr uint32_t kMaxDenseCities{ 1024 };
+
+private:
+    uint32_t tenure_;
+
+    uint32_t iteration_{ 1 };
+
+    // The latest expiration ever set, after which no move is forbidden
+    uint32_t horizon_{ 1 };
+    math::Matrix<uint32_t> expirations_;
+
+    // The expirations of the forbidden pairs of the large instances, the expired ones are removed periodically
+    std::unordered_map<uint64_t, uint32_t> sparse_expirations_;
+};
+} // namespace tsp::algorithm
@@ -0,0 +1,148 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "tsp/algorithm/algorithm.hpp"
+#include "tsp/algorithm/elitepool.hpp"
+#include "tsp/algorithm/longtermmemory.hpp"
+#include "tsp/algorithm/reactivememory.hpp"
+#include "tsp/algorithm/ts.hpp"
+#include "tsp/neighbourhood/neighbourhood.hpp"
+#include "tsp/tourhash.hpp"
+#include "utils/random.hpp"
+#include "utils/workergroup.hpp"
+
+namespace tsp::algorithm
+{
+/**
+ * @brief The tabu search working directly on the given representation of the distances
+ *
+ * @tparam Distances the representation of the distances between cities
+ */
+template <class Distances> class TabuSearch : public Algorithm
+{
+public:
+    /**
+     * @brief Construct a new TabuSearch object
+     *
+     * @param distances the distances between cities
+     * @param parameters the parameters of the search
+     */
+    TabuSearch(std::shared_ptr<const Distances> distances, const TS::Parameters& parameters);
+
+public:
+    /**
+     * @brief Solve the given problem
+     *
+     * @return Solution the solution of the given problem
+     */
+    Solution Solve() override;
+
+protected:
+    /**
+     * @brief Calculate weight of the given solution
+     *
+     * @param solution the imput solution
+     * @return uint32_t the weight of the solution
+     */
+    uint32_t CalculateWeight(const Solution& solution) const;
+
+    /**
+     * @brief Calculate new solution in the neighbourhood of the given one
+     *
+     * @param solution the solution from which a new one should be derived
+     * @return Solution a new solution
+     */
+    Solution CalculateNeighbour(Solution solution);
+
+    /**
+     * @brief Calculate the starting path with the configured heuristic
+     *
+     * @return Path a new starting path
+     */
+    Path CalculateStartingPath();
+
+    /**
+     * @brief Calculate a uniformly random path
+     *
+     * @return Path a random path
+     */
+    Path CalculateRandomPath();
+
+    /**
+     * @brief Calculate the solution starting a new epoch with the configured strategy
+     *
+     * @param epoch_best the best solution of the finished epoch, which is offered to the elite
+     * @return Solution the starting solution of the next epoch
+     */
+    Solution CalculateRestart(const Solution& epoch_best);
+
+    /**
+     * @brief Adapt the tenure to the solution reached by the last move and escape from it when the search is trapped
+     *
+     * @param solution the current solution, which is moved away by random swaps on an escape
+     */
+    void React(Solution& solution);
+
+private:
+    std::shared_ptr<const Distances> shared_distances_;
+    const Distances& distances_;
+
+    Solution solution_;
+
+    const uint32_t kIterationsPerEpoch;
+    const std::chrono::milliseconds kTimeLimit;
+    const std::chrono::microseconds kMaxOvershoot;
+    std::shared_ptr<const utils::CancellationToken> cancellation_;
+
+    std::vector<std::unique_ptr<neighbourhood::Neighbourhood<Distances>>> neighbourhoods_;
+
+    // The heuristic of the starting path and the candidates, which it may use
+    construction::Parameters construction_;
+    std::shared_ptr<const CandidateList> candidate_list_;
+
+    // The strategy of the restarts and the long-term memory, which informs them
+    const Restart kRestart;
+    std::optional<LongTermMemory> memory_;
+    uint32_t restarts_{};
+
+    // The elite shared with the other islands and the amount of iterations between the publications to it
+    std::shared_ptr<ElitePool> pool_;
+    const uint32_t kExchangeInterval;
+
+    utils::Random random_;
+
+    // The hash of the current solution and the memory of the visited ones, only used by the reactive search
+    std::optional<TourHash> hasher_;
+    std::optional<ReactiveMemory> reactive_;
+    uint64_t hash_{};
+
+    std::unique_ptr<utils::WorkerGroup> workers_;
+
+    // The candidates found by every worker in every neighbourhood
+    std::vector<neighbourhood::Candidates> candidates_;
+};
+} // namespace tsp::algorithm
\ No newline at end of file
@@ -20,110 +20,107 @@
 #pragma once
 
 #include <chrono>
+#include <cstdint>
+#include <memory>
 #include <vector>
 
-#include "math/matrix.hpp"
 #include "tsp/algorithm/algorithm.hpp"
+#include "tsp/algorithm/elitepool.hpp"
+#include "tsp/algorithm/longtermmemory.hpp"
+#include "tsp/candidatelist.hpp"
+#include "tsp/construction.hpp"
+#include "tsp/distances.hpp"
+#include "tsp/neighbourhood/neighbourhood.hpp"
+#include "utils/cancellationtoken.hpp"
+#include "utils/threadpool.hpp"
 
 namespace tsp::algorithm
 {
+/**
+ * @brief Tabu search, which dispatches once to the implementation for the representation of the distances
+ */
 class TS : public Algorithm
 {
-    struct Tabu
+public:
+    struct Parameters
     {
-        size_t first, last;
-
-        /**
-         * @brief Overriding the comparing operator for the tabu entry
-         *
-         * @return true if the objects are equal
-         * @return false otherwise
-         */
-        bool operator==(const Tabu&) const;
-    };
+        // The tenure of the tabu moves, which is also the maximum amount of the forbidden moves
+        size_t max_tabu{};
 
-public:
-    /**
-     * @brief Construct a new TS object
-     *
-     * @param distances the matrix of distances between cities
-     * @param max_tabu the maximum size of the tabu list
-     * @param max_iterations the maximum size of the iterations in each epoch
-     * @param time_limit the limit of time
-     */
-    TS(math::Matrix<uint32_t> distances, size_t max_tabu, uint32_t max_iterations,
-       std::chrono::milliseconds time_limit);
+        // The maximum size of the iterations in each epoch
+        uint32_t max_iterations{};
 
-public:
-    /**
-     * @brief Solve the given problem
-     *
-     * @return Solution the solution of the given problem
-     */
-    Solution Solve() override;
+        // The limit of time
+        std::chrono::milliseconds time_limit{};
 
-protected:
-    /**
-     * @brief Calculate weight of the given solution
-     *
-     * @param solution the imput solution
-     * @return uint32_t the weight of the solution
-     */
-    uint32_t CalculateWeight(const Solution& solution);
+        // The time, by which the search may run past the limit, as the clock is read only every few iterations
+        std::chrono::microseconds max_overshoot{ 1000 };
 
-    /**
-     * @brief Calculate new solution in the neighbourhood of the given one
-     *
-     * @param solution the solution from which a new one should be derived
-     * @return Solution a new solution
-     */
-    Solution CalculateNeighbour(Solution solution);
+        // The token stopping the search early with the best solution found so far, nullptr if it cannot be cancelled
+        std::shared_ptr<const utils::CancellationToken> cancellation;
 
-    /**
-     * @brief Add the tabu to the list
-     *
-     * @param value the tabu to add
-     */
-    void AddTabu(const Tabu& value);
+        // The seed of the random generator used by this solver, the same seed gives the same sequence of tours
+        uint64_t seed{};
 
-    /**
-     * @brief Calculate the starting path
-     *
-     * @return Path a new starting pat
-     */
-    Path CalculateStartingPath();
+        // The amount of threads evaluating the neighbourhood in every iteration, the islands use a single one each
+        size_t threads{ 1 };
 
-    /**
-     * @brief Calculate a random path
-     *
-     * @return Path a random path
-     */
-    Path CalculateRandomPath();
+        // The neighbourhoods scanned in every iteration
+        std::vector<neighbourhood::Type> neighbourhoods{ neighbourhood::Type::kSwap };
+
+        // The nearest neighbours restricting the scanned moves, nullptr scans the whole neighbourhoods
+        std::shared_ptr<const CandidateList> candidates;
+
+        // Skip the cities, which had no improving move during the last scan
+        bool dont_look_bits{};
+
+        // The heuristic building the starting tour, the greedy edge uses the candidates when they are given
+        construction::Type construction{ construction::Type::kNearestNeighbour };
+
+        // The amount of the starting cities tried by the nearest neighbour heuristic
+        uint32_t construction_roots{ 1 };
+
+        // Adapt the tenure to the cycles of the visited solutions and escape when the search is trapped
+        bool reactive{};
+
+        // The way, in which a new epoch starts, the long-term memory is kept only by the informed restarts
+        Restart restart{ Restart::kRandom };
+
+        // The amount of the best solutions of the past epochs, between which the elite restarts relink
+        size_t elite{ 8 };
+
+        // The amount of the cooperating searches, which share their elite solutions, zero uses all the hardware threads
+        size_t islands{ 1 };
 
+        // The amount of iterations, after which an island publishes its best solution to the others
+        uint32_t exchange_interval{ 1000 };
+
+        // The elite solutions shared by the islands, nullptr for an isolated search
+        std::shared_ptr<ElitePool> pool;
+
+        // The pool running the islands as the sub-tasks of the repeat, nullptr runs them on their own threads
+        utils::ThreadPool* scheduler{};
+    };
+
+public:
     /**
-     * @brief Create a list of tabus for the given solution
+     * @brief Construct a new TS object
      *
-     * @param solution the solution for which tabus should be calculated
-     * @return std::vector<Tabu> the list of tabus
+     * @param distances the distances between cities, which are shared read-only between the solvers
+     * @param parameters the parameters of the search
      */
-    std::vector<Tabu> CalculateTabus(Solution solution) const;
+    TS(std::shared_ptr<const tsp::Distances> distances, const Parameters& parameters);
 
+public:
     /**
-     * @brief Swap two positions in the solution
+     * @brief Solve the given problem
      *
-     * @param solution the solution to update
-     * @param i the first position
-     * @param j the second position
+     * @return Solution the solution of the given problem
      */
-    void Swap(Solution& solution, uint32_t i, uint32_t j);
+    Solution Solve() override;
 
 private:
-    Solution solution_;
-
-    const uint32_t kIterationsPerEpoch;
-    const std::chrono::milliseconds kTimeLimit;
-
-    const size_t kMaxTabuSize;
-    std::vector<Tabu> tabus_;
+    // The search instantiated for the representation of the distances
+    std::unique_ptr<Algorithm> search_;
 };
-} // namespace tsp::algorithm
\ No newline at end of file
+} // namespace tsp::algorithm
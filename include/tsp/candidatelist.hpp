@@ -0,0 +1,81 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "tsp/distances.hpp"
+
+namespace tsp
+{
+/**
+ * @brief The nearest neighbours of every city, both by the outgoing and by the incoming arcs
+ */
+class CandidateList
+{
+public:
+    /**
+     * @brief Construct a new CandidateList object
+     *
+     * @param distances the distances between cities
+     * @param size the amount of the neighbours kept for every city in each direction
+     */
+    CandidateList(const Distances& distances, uint32_t size);
+
+public:
+    /**
+     * @brief Get the cities, which are the closest to reach from the given one
+     *
+     * @param city the city
+     * @return std::span<const uint32_t> the cities sorted by the distance
+     */
+    std::span<const uint32_t> Successors(uint32_t city) const noexcept
+    {
+        return { successors_.data() + static_cast<size_t>(city) * size_, size_ };
+    }
+
+    /**
+     * @brief Get the cities, from which the given one is the closest to reach
+     *
+     * @param city the city
+     * @return std::span<const uint32_t> the cities sorted by the distance
+     */
+    std::span<const uint32_t> Predecessors(uint32_t city) const noexcept
+    {
+        return { predecessors_.data() + static_cast<size_t>(city) * size_, size_ };
+    }
+
+    uint32_t Size() const noexcept
+    {
+        return size_;
+    }
+
+private:
+    template <class Representation> void Build(const Representation& distances, uint32_t size);
+    void Build(const CoordinateDistances& distances, uint32_t size);
+
+private:
+    uint32_t size_;
+    std::vector<uint32_t> successors_;
+    std::vector<uint32_t> predecessors_;
+};
+} // namespace tsp
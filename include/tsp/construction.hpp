@@ -0,0 +1,82 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "tsp/candidatelist.hpp"
+#include "tsp/distances.hpp"
+#include "tsp/tour.hpp"
+#include "utils/random.hpp"
+
+namespace tsp::construction
+{
+/**
+ * @brief Heuristics building the starting tour of a search
+ */
+enum class Type
+{
+    // The nearest unvisited city is appended, starting from one or several roots
+    kNearestNeighbour,
+
+    // The shortest edges are taken as long as they keep the fragments of a tour, then the fragments are joined
+    kGreedyEdge,
+
+    // The cities are ordered along the Hilbert curve over their coordinates
+    kSpaceFillingCurve,
+
+    // A uniformly random permutation
+    kRandom
+};
+
+struct Parameters
+{
+    Type type{ Type::kNearestNeighbour };
+
+    // The amount of the starting cities tried by the nearest neighbour, the shortest tour is used
+    uint32_t roots{ 1 };
+
+    // The nearest neighbours, from which the greedy edge takes the edges, nullptr finds its own ones
+    const CandidateList* candidates{};
+};
+
+/**
+ * @brief Parse the name of the heuristic
+ *
+ * @param name the name used by the configuration (nearest, greedy, curve or random)
+ * @return Type the heuristic
+ * @throw std::runtime_error if the name is unknown
+ */
+Type ParseType(const std::string& name);
+
+/**
+ * @brief Build the tour with the given heuristic
+ *
+ * @tparam Distances the representation of the distances
+ * @param distances the distances between cities
+ * @param parameters the heuristic and its parameters
+ * @param random the generator used by the randomised heuristics
+ * @return Tour the tour over all the cities
+ * @throw std::runtime_error if the heuristic does not support the instance
+ */
+template <class Distances>
+Tour Construct(const Distances& distances, const Parameters& parameters, utils::Random& random);
+} // namespace tsp::construction
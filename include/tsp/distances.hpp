@@ -0,0 +1,293 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "math/kdtree.hpp"
+#include "math/matrix.hpp"
+#include "math/point.hpp"
+#include "math/triangularmatrix.hpp"
+
+namespace tsp
+{
+/**
+ * @brief Distances between all the pairs of cities, stored as the offsets from the smallest distance
+ *
+ * The distance from a city to itself is not kept, as no tour uses it.
+ *
+ * @tparam T the type of the stored offsets
+ */
+template <class T> class DenseDistances
+{
+public:
+    using value_type = T;
+
+public:
+    /**
+     * @brief Construct a new DenseDistances object
+     *
+     * @param matrix the offsets of the distances
+     * @param offset the value added to every offset
+     */
+    DenseDistances(math::Matrix<T> matrix, uint32_t offset) : matrix_{ std::move(matrix) }, offset_{ offset }
+    {
+    }
+
+public:
+    uint32_t operator()(uint32_t from, uint32_t to) const noexcept
+    {
+        return offset_ + matrix_(from, to);
+    }
+
+    size_t Size() const noexcept
+    {
+        return matrix_.Rows();
+    }
+
+    const math::Matrix<T>& GetMatrix() const noexcept
+    {
+        return matrix_;
+    }
+
+    uint32_t GetOffset() const noexcept
+    {
+        return offset_;
+    }
+
+private:
+    math::Matrix<T> matrix_;
+    uint32_t offset_;
+};
+
+/**
+ * @brief Symmetric distances, which keep only one triangle of the matrix of the offsets from the smallest distance
+ *
+ * @tparam T the type of the stored offsets
+ */
+template <class T> class SymmetricDistances
+{
+public:
+    using value_type = T;
+
+public:
+    /**
+     * @brief Construct a new SymmetricDistances object
+     *
+     * @param matrix the offsets of the distances
+     * @param offset the value added to every offset
+     */
+    SymmetricDistances(math::TriangularMatrix<T> matrix, uint32_t offset)
+        : matrix_{ std::move(matrix) }, offset_{ offset }
+    {
+    }
+
+public:
+    uint32_t operator()(uint32_t from, uint32_t to) const noexcept
+    {
+        return offset_ + matrix_(from, to);
+    }
+
+    size_t Size() const noexcept
+    {
+        return matrix_.Rows();
+    }
+
+    const math::TriangularMatrix<T>& GetMatrix() const noexcept
+    {
+        return matrix_;
+    }
+
+    uint32_t GetOffset() const noexcept
+    {
+        return offset_;
+    }
+
+private:
+    math::TriangularMatrix<T> matrix_;
+    uint32_t offset_;
+};
+
+/**
+ * @brief Functions of the TSPLIB, which give the distance between two cities from their coordinates
+ */
+enum class Metric
+{
+    // EUC_2D, the Euclidean distance rounded to the nearest integer
+    kEuclidean,
+
+    // CEIL_2D, the Euclidean distance rounded up
+    kCeiling,
+
+    // GEO, the distance on the Earth between the coordinates given as DDD.MM (degrees and minutes)
+    kGeographic,
+
+    // ATT, the pseudo-Euclidean distance
+    kAtt
+};
+
+/**
+ * @brief Distances computed on demand from the coordinates of the cities, so the memory grows linearly with them
+ *
+ * The distances to the nearest neighbours of every city may be cached, as the moves evaluate them the most often.
+ */
+class CoordinateDistances
+{
+public:
+    using value_type = uint32_t;
+
+public:
+    /**
+     * @brief Construct a new CoordinateDistances object
+     *
+     * @param points the coordinates of the cities
+     * @param metric the function of the distance
+     * @param cached the amount of the nearest neighbours of every city, whose distances are cached
+     */
+    CoordinateDistances(std::vector<math::Point> points, Metric metric, uint32_t cached = 0);
+
+public:
+    uint32_t operator()(uint32_t from, uint32_t to) const noexcept
+    {
+        if (cached_ != 0)
+        {
+            // The neighbours of every row are sorted by the index, so the lookup takes O(log k)
+            const auto row = neighbours_.begin() + static_cast<ptrdiff_t>(from) * cached_;
+            const auto neighbour = std::lower_bound(row, row + cached_, to);
+            if (neighbour != row + cached_ && *neighbour == to)
+            {
+                return cache_[static_cast<size_t>(neighbour - neighbours_.begin())];
+            }
+        }
+
+        return Compute(from, to);
+    }
+
+    size_t Size() const noexcept
+    {
+        return points_.size();
+    }
+
+    /**
+     * @brief Get the coordinates of the cities, as given in the instance
+     *
+     * @return const std::vector<math::Point>& the coordinates
+     */
+    const std::vector<math::Point>& GetPoints() const noexcept
+    {
+        return points_;
+    }
+
+    Metric GetMetric() const noexcept
+    {
+        return metric_;
+    }
+
+    /**
+     * @brief Compute the distance between two cities without the cache
+     *
+     * @param from the first city
+     * @param to the second city
+     * @return uint32_t the distance
+     */
+    uint32_t Compute(uint32_t from, uint32_t to) const noexcept;
+
+    /**
+     * @brief Find the cities closest to the given one, in O(log n) for the planar metrics
+     *
+     * @param city the city
+     * @param count the amount of the cities to find
+     * @param result the found cities sorted by the distance, ties are kept in the order of the indices
+     */
+    void FindNearest(uint32_t city, uint32_t count, std::vector<uint32_t>& result) const;
+
+    /**
+     * @brief Get the spatial index of the cities
+     *
+     * @return const math::KdTree* the index or nullptr if the metric is not planar
+     */
+    const math::KdTree* GetIndex() const noexcept
+    {
+        return index_ ? &*index_ : nullptr;
+    }
+
+private:
+    std::vector<math::Point> points_;
+    Metric metric_;
+
+    // The latitudes and the longitudes in radians, used only by the geographic metric
+    std::vector<math::Point> radians_;
+
+    // The index of the cities, built only for the planar metrics
+    std::optional<math::KdTree> index_;
+
+    // The nearest neighbours of every city sorted by the index and the distances to them, in rows of the cached amount
+    uint32_t cached_{};
+    std::vector<uint32_t> neighbours_;
+    std::vector<uint32_t> cache_;
+};
+
+/**
+ * @brief Any of the representations of the distances, the solvers are instantiated for each of them
+ */
+using Distances = std::variant<DenseDistances<uint8_t>, DenseDistances<uint16_t>, DenseDistances<uint32_t>,
+                               SymmetricDistances<uint8_t>, SymmetricDistances<uint16_t>, SymmetricDistances<uint32_t>,
+                               CoordinateDistances>;
+
+/**
+ * @brief Expand the macro for every representation of the distances, used by the explicit instantiations
+ */
+#define TSP_FOR_EACH_DISTANCES(MACRO)                                                                                  \
+    MACRO(tsp::DenseDistances<uint8_t>)                                                                                \
+    MACRO(tsp::DenseDistances<uint16_t>)                                                                               \
+    MACRO(tsp::DenseDistances<uint32_t>)                                                                               \
+    MACRO(tsp::SymmetricDistances<uint8_t>)                                                                            \
+    MACRO(tsp::SymmetricDistances<uint16_t>)                                                                           \
+    MACRO(tsp::SymmetricDistances<uint32_t>)                                                                           \
+    MACRO(tsp::CoordinateDistances)
+
+/**
+ * @brief Store the distances in the smallest representation, which keeps all of them
+ *
+ * The offsets use the narrowest unsigned type fitting the range of the distances and the symmetric instances keep
+ * only one triangle of the matrix.
+ *
+ * @param matrix the square matrix of distances between cities
+ * @return Distances the compact distances
+ * @throw std::runtime_error if the matrix is not square
+ */
+Distances Compact(const math::Matrix<uint32_t>& matrix);
+
+/**
+ * @brief Parse the name of the edge weight type of the TSPLIB, which is computed from the coordinates
+ *
+ * @param name the value of EDGE_WEIGHT_TYPE
+ * @return Metric the metric
+ * @throw std::runtime_error if the type is not supported
+ */
+Metric ParseMetric(std::string_view name);
+} // namespace tsp
@@ -0,0 +1,233 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "tsp/distances.hpp"
+
+/**
+ * @brief Vectorised kernels evaluating the weights of the tours and the deltas of blocks of moves
+ *
+ * Every kernel has a scalar, an SSE4.1, an AVX2 and an AVX-512 implementation for the dense distances. The best
+ * implementation supported by the processor is selected at runtime, all of them give exactly the same results. The
+ * other representations of the distances use the generic scalar kernels.
+ */
+namespace tsp::kernels
+{
+enum class Level
+{
+    kScalar,
+    kSse4,
+    kAvx2,
+    kAvx512
+};
+
+/**
+ * @brief The maximum amount of the moves evaluated by a single call of the delta kernels
+ */
+constexpr size_t kBlockSize{ 64 };
+
+/**
+ * @brief Get the instruction set used by the kernels
+ *
+ * @return Level the level, by default the best one supported by the processor
+ */
+Level GetLevel();
+
+/**
+ * @brief Force the kernels to use the given instruction set
+ *
+ * @param level the level, which is lowered to the best one supported by the processor
+ */
+void SetLevel(Level level);
+
+/**
+ * @brief Parse the name of the instruction set (scalar, sse4, avx2 or avx512)
+ *
+ * @param name the name
+ * @return Level the level
+ */
+Level ParseLevel(const std::string& name);
+
+/**
+ * @brief Calculate the weight of the closed tour
+ *
+ * @param distances the distances between cities
+ * @param tour the cities of the tour
+ * @param size the amount of the cities
+ * @return uint64_t the weight of the tour
+ */
+template <class T> uint64_t TourLength(const DenseDistances<T>& distances, const uint32_t* tour, size_t size);
+
+/**
+ * @brief Get the weights of the edges of the closed tour in both directions
+ *
+ * @param distances the distances between cities
+ * @param tour the cities of the tour
+ * @param size the amount of the cities
+ * @param forward the weights of the edges from the city at every position to the next one
+ * @param backward the weights of the edges from the next city to the city at every position, may be nullptr
+ */
+template <class T>
+void TourEdges(const DenseDistances<T>& distances, const uint32_t* tour, size_t size, uint32_t* forward,
+               uint32_t* backward);
+
+/**
+ * @brief Calculate the deltas of swapping the position i with the positions in [first, first + count)
+ *
+ * The positions should not be adjacent to i and should not touch the ends of the tour: i + 2 <= first and
+ * first + count < size.
+ *
+ * @param distances the distances between cities
+ * @param tour the cities of the tour
+ * @param edges the forward weights of the edges of the tour
+ * @param i the swapped position
+ * @param first the first of the positions to swap with
+ * @param count the amount of the positions, at most kBlockSize
+ * @param deltas the differences between the new and the old weights
+ */
+template <class T>
+void SwapDeltas(const DenseDistances<T>& distances, const uint32_t* tour, const uint32_t* edges, size_t i,
+                size_t first, size_t count, int64_t* deltas);
+
+/**
+ * @brief Calculate the deltas of reversing the segments from the position i to the positions in [first, first + count)
+ *
+ * The last position of a segment should not be the end of the tour: i < first and first + count < size.
+ *
+ * @param distances the distances between cities
+ * @param tour the cities of the tour
+ * @param edges the forward weights of the edges of the tour
+ * @param forward the sums of the forward weights of the edges before every position
+ * @param backward the sums of the backward weights of the edges before every position
+ * @param i the first position of the segments
+ * @param first the first of the last positions of the segments
+ * @param count the amount of the segments, at most kBlockSize
+ * @param deltas the differences between the new and the old weights
+ */
+template <class T>
+void ReversalDeltas(const DenseDistances<T>& distances, const uint32_t* tour, const uint32_t* edges,
+                    const int64_t* forward, const int64_t* backward, size_t i, size_t first, size_t count,
+                    int64_t* deltas);
+
+/**
+ * @brief Calculate the deltas of inserting the segment [i, i + length) after the positions in [first, first + count)
+ *
+ * The positions should be outside of the segment, not directly before it and not at the end of the tour:
+ * first + count < size.
+ *
+ * @param distances the distances between cities
+ * @param tour the cities of the tour
+ * @param edges the forward weights of the edges of the tour
+ * @param i the first position of the segment
+ * @param length the length of the segment
+ * @param first the first of the positions, after which the segment is inserted
+ * @param count the amount of the positions, at most kBlockSize
+ * @param deltas the differences between the new and the old weights
+ */
+template <class T>
+void InsertionDeltas(const DenseDistances<T>& distances, const uint32_t* tour, const uint32_t* edges, size_t i,
+                     size_t length, size_t first, size_t count, int64_t* deltas);
+
+/**
+ * @brief The kernel finding the smallest of the sums first[k] + second[k], which should not overflow
+ */
+template <class T> using MinPlusKernel = T (*)(const T* first, const T* second, size_t count);
+
+/**
+ * @brief Select the min-plus kernel for the current instruction set, once for many calls
+ *
+ * @tparam T the type of the values (uint16_t or uint32_t)
+ * @return MinPlusKernel<T> the kernel
+ */
+template <class T> MinPlusKernel<T> GetMinPlus();
+
+// The generic kernels with the same contracts as above, used for the distances without a vectorised layout
+
+template <class Distances> uint64_t TourLength(const Distances& distances, const uint32_t* tour, size_t size)
+{
+    uint64_t result{};
+    for (size_t k{}; k < size; ++k)
+    {
+        result += distances(tour[k], tour[(k + 1) % size]);
+    }
+
+    return result;
+}
+
+template <class Distances>
+void TourEdges(const Distances& distances, const uint32_t* tour, size_t size, uint32_t* forward, uint32_t* backward)
+{
+    for (size_t k{}; k < size; ++k)
+    {
+        const auto next = tour[(k + 1) % size];
+        forward[k] = distances(tour[k], next);
+        if (backward != nullptr)
+        {
+            backward[k] = distances(next, tour[k]);
+        }
+    }
+}
+
+template <class Distances>
+void SwapDeltas(const Distances& distances, const uint32_t* tour, const uint32_t* edges, size_t i, size_t first,
+                size_t count, int64_t* deltas)
+{
+    const auto city = tour[i];
+    const int64_t base = -static_cast<int64_t>(edges[i - 1]) - edges[i];
+    for (size_t k{}; k < count; ++k)
+    {
+        const auto j = first + k;
+        deltas[k] = base - edges[j - 1] - edges[j] + distances(tour[i - 1], tour[j]) + distances(tour[j], tour[i + 1]) +
+                    distances(tour[j - 1], city) + distances(city, tour[j + 1]);
+    }
+}
+
+template <class Distances>
+void ReversalDeltas(const Distances& distances, const uint32_t* tour, const uint32_t* edges, const int64_t* forward,
+                    const int64_t* backward, size_t i, size_t first, size_t count, int64_t* deltas)
+{
+    const int64_t base = -static_cast<int64_t>(edges[i - 1]) + forward[i] - backward[i];
+    for (size_t k{}; k < count; ++k)
+    {
+        const auto j = first + k;
+        deltas[k] = base - edges[j] + backward[j] - forward[j] + distances(tour[i - 1], tour[j]) +
+                    distances(tour[i], tour[j + 1]);
+    }
+}
+
+template <class Distances>
+void InsertionDeltas(const Distances& distances, const uint32_t* tour, const uint32_t* edges, size_t i, size_t length,
+                     size_t first, size_t count, int64_t* deltas)
+{
+    const auto head = tour[i];
+    const auto tail = tour[i + length - 1];
+    const auto next = tour[(i + length) % distances.Size()];
+    const int64_t base = static_cast<int64_t>(distances(tour[i - 1], next)) - edges[i - 1] - edges[i + length - 1];
+    for (size_t k{}; k < count; ++k)
+    {
+        const auto after = first + k;
+        deltas[k] = base - edges[after] + distances(tour[after], head) + distances(tail, tour[after + 1]);
+    }
+}
+} // namespace tsp::kernels
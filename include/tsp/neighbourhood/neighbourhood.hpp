@@ -0,0 +1,330 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "tsp/algorithm/tabumemory.hpp"
+#include "tsp/candidatelist.hpp"
+#include "tsp/distances.hpp"
+#include "tsp/tour.hpp"
+#include "utils/memory/alignedallocator.hpp"
+
+namespace tsp::neighbourhood
+{
+enum class Type
+{
+    kSwap,
+    kTwoOpt,
+    kOrOpt
+};
+
+/**
+ * @brief Move of a neighbourhood, the meaning of the positions is defined by the neighbourhood, which created it
+ */
+struct Move
+{
+    int64_t delta{ std::numeric_limits<int64_t>::max() };
+    uint32_t i{}, j{}, k{};
+
+    /**
+     * @brief Check whether the move should be preferred over another one
+     *
+     * @return true if the move has a smaller delta or the same delta and smaller positions
+     * @return false otherwise
+     */
+    bool IsBetterThan(const Move& another) const noexcept
+    {
+        if (delta != another.delta)
+        {
+            return delta < another.delta;
+        }
+        if (i != another.i)
+        {
+            return i < another.i;
+        }
+
+        return j != another.j ? j < another.j : k < another.k;
+    }
+
+    bool IsValid() const noexcept
+    {
+        return delta != std::numeric_limits<int64_t>::max();
+    }
+};
+
+struct alignas(utils::memory::kCacheLineSize) Candidates
+{
+    // The best allowed move
+    Move best;
+
+    // The best forbidden move, which is used when every move is forbidden
+    Move fallback;
+
+    /**
+     * @brief Merge the candidates found in another part of the neighbourhood
+     *
+     * @param another the candidates to merge
+     */
+    void Merge(const Candidates& another) noexcept
+    {
+        if (another.best.IsBetterThan(best))
+        {
+            best = another.best;
+        }
+        if (another.fallback.IsBetterThan(fallback))
+        {
+            fallback = another.fallback;
+        }
+    }
+};
+
+/**
+ * @brief Set of the moves, which lead from a tour to its neighbours, together with the tabu memory of the moves
+ *
+ * The neighbourhood is scanned by rows, a row is the set of moves started from a single position of the tour. When a
+ * candidate list is set, only the moves creating at least one edge from the list are checked. With the don't look
+ * bits enabled, the rows of the cities, which had no improving move during the last scan, are skipped until one of the
+ * edges around them changes.
+ *
+ * @tparam Distances the representation of the distances between cities
+ */
+template <class Distances> class Neighbourhood
+{
+public:
+    /**
+     * @brief Construct a new Neighbourhood object
+     *
+     * @param distances the distances between cities
+     * @param tenure the amount of iterations, for which the attributes of an applied move stay forbidden
+     */
+    Neighbourhood(const Distances& distances, uint32_t tenure);
+    virtual ~Neighbourhood() = default;
+
+public:
+    /**
+     * @brief Restrict the scanned moves to the ones creating an edge from the candidate list
+     *
+     * @param candidates the candidate list, nullptr scans the whole neighbourhood
+     */
+    void SetCandidates(std::shared_ptr<const CandidateList> candidates);
+
+    /**
+     * @brief Enable or disable skipping the rows of the cities without an improving move
+     *
+     * @param enabled true to use the don't look bits
+     */
+    void SetDontLookBits(bool enabled);
+
+    /**
+     * @brief Change the amount of iterations, for which the attributes of the next applied moves stay forbidden
+     *
+     * @param tenure the new tenure
+     */
+    void SetTenure(uint32_t tenure) noexcept;
+
+    /**
+     * @brief Prepare the neighbourhood for scanning the given tour, which stores the weights of its edges
+     *
+     * @param tour the tour, which will be scanned
+     */
+    virtual void Prepare(const Tour& tour);
+
+    /**
+     * @brief Find the best moves in the given rows of the neighbourhood
+     *
+     * The first city of the tour is never moved. Different rows may be scanned by different threads at the same time.
+     *
+     * @param tour the tour to scan
+     * @param aspiration the delta, below which a forbidden move is allowed
+     * @param first the first row to scan
+     * @param step the distance between the scanned rows
+     * @return Candidates the best allowed and forbidden moves
+     */
+    Candidates Scan(const Tour& tour, int64_t aspiration, size_t first, size_t step);
+
+    /**
+     * @brief Apply the move to the tour and forbid reverting it
+     *
+     * @param tour the tour to update
+     * @param move the move found by this neighbourhood
+     */
+    void Apply(Tour& tour, const Move& move);
+
+    /**
+     * @brief Get the cities, whose edges in the tour before and after the move include all the changed edges
+     *
+     * @param tour the tour before the move
+     * @param move the move found by this neighbourhood
+     * @return std::array<uint32_t, 4> the cities, which may repeat
+     */
+    virtual std::array<uint32_t, 4> GetChangedCities(const Tour& tour, const Move& move) const = 0;
+
+    /**
+     * @brief Move the tabu memory to the next iteration
+     */
+    void Advance();
+
+    /**
+     * @brief Release all the forbidden moves and clear the don't look bits
+     */
+    void Clear();
+
+    /**
+     * @brief Clear the don't look bits, so every row is scanned again
+     */
+    void ResetDontLookBits();
+
+protected:
+    /**
+     * @brief Check all the moves of the row
+     *
+     * @param tour the tour to scan
+     * @param aspiration the delta, below which a forbidden move is allowed
+     * @param row the position of the row
+     * @param result the best moves to update
+     * @return true if the row contains an improving move
+     * @return false otherwise
+     */
+    virtual bool ScanRow(const Tour& tour, int64_t aspiration, size_t row, Candidates& result) const = 0;
+
+    /**
+     * @brief Check the moves of the row, which create an edge from the candidate list
+     *
+     * @param tour the tour to scan
+     * @param aspiration the delta, below which a forbidden move is allowed
+     * @param row the position of the row
+     * @param result the best moves to update
+     * @return true if the row contains an improving move
+     * @return false otherwise
+     */
+    virtual bool ScanCandidateRow(const Tour& tour, int64_t aspiration, size_t row, Candidates& result) const = 0;
+
+    /**
+     * @brief Remember the move, which is about to be applied: forbid its attributes and wake up the touched cities
+     *
+     * @param tour the tour before the move
+     * @param move the move
+     */
+    virtual void Record(const Tour& tour, const Move& move) = 0;
+
+    /**
+     * @brief Change the tour according to the move
+     *
+     * @param tour the tour to update
+     * @param move the move
+     */
+    virtual void Perform(Tour& tour, const Move& move) const = 0;
+
+    /**
+     * @brief Update the best moves with the given one
+     *
+     * @param tour the scanned tour
+     * @param move the move to consider
+     * @param aspiration the delta, below which a forbidden move is allowed
+     * @param is_tabu the callable checking whether the move is forbidden, only called when needed
+     * @param result the best moves to update
+     */
+    template <class IsTabu>
+    void Consider([[maybe_unused]] const Tour& tour, const Move& move, int64_t aspiration, IsTabu&& is_tabu,
+                  Candidates& result) const
+    {
+#ifdef TSP_VERIFY_MOVES
+        Verify(tour, move);
+#endif
+
+        if (!move.IsBetterThan(result.best))
+        {
+            return;
+        }
+
+        if (move.delta >= aspiration && is_tabu())
+        {
+            if (move.IsBetterThan(result.fallback))
+            {
+                result.fallback = move;
+            }
+            return;
+        }
+
+        result.best = move;
+    }
+
+    /**
+     * @brief Clear the don't look bit of the city
+     *
+     * @param city the city, which should be scanned again
+     */
+    void Wake(uint32_t city) noexcept
+    {
+        if (!dont_look_.empty())
+        {
+            dont_look_[city] = 0;
+        }
+    }
+
+#ifdef TSP_VERIFY_MOVES
+    /**
+     * @brief Compare the delta of the move with the full recalculation of the weight
+     *
+     * @param tour the tour before the move
+     * @param move the move to verify
+     */
+    void Verify(Tour tour, const Move& move) const;
+#endif
+
+protected:
+    const Distances& distances_;
+    algorithm::TabuMemory tabus_;
+    std::shared_ptr<const CandidateList> candidates_;
+
+    // The weights of the edges from the city at every position of the prepared tour to the next one
+    std::vector<uint32_t> edges_;
+
+private:
+    // Bytes instead of bits, so different rows can be updated by different threads
+    std::vector<uint8_t> dont_look_;
+};
+
+/**
+ * @brief Parse the name of the neighbourhood used in the config
+ *
+ * @param name the name of the neighbourhood (swap, 2opt or oropt)
+ * @return Type the type of the neighbourhood
+ */
+Type ParseType(const std::string& name);
+
+/**
+ * @brief Create the neighbourhood of the given type
+ *
+ * @param type the type of the neighbourhood
+ * @param distances the distances between cities
+ * @param tenure the amount of iterations, for which the attributes of an applied move stay forbidden
+ * @return std::unique_ptr<Neighbourhood<Distances>> the neighbourhood
+ */
+template <class Distances>
+std::unique_ptr<Neighbourhood<Distances>> Create(Type type, const Distances& distances, uint32_t tenure);
+} // namespace tsp::neighbourhood
@@ -0,0 +1,123 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include "tsp/neighbourhood/neighbourhood.hpp"
+
+namespace tsp::neighbourhood
+{
+/**
+ * @brief Neighbourhood moving the segment of up to three cities starting at position i to another place of the tour
+ *
+ * The move keeps the orientation of the segment, stores its length in j and the position of the city, after which the
+ * segment is inserted, in k. The tabu attributes of the move are the two edges removed around the segment. With a
+ * candidate list, the segment is only inserted behind a nearest predecessor of its first city or in front of a nearest
+ * successor of its last city.
+ *
+ * @tparam Distances the representation of the distances between cities
+ */
+template <class Distances> class OrOpt : public Neighbourhood<Distances>
+{
+private:
+    using Base = Neighbourhood<Distances>;
+    using Base::candidates_;
+    using Base::Consider;
+    using Base::distances_;
+    using Base::edges_;
+    using Base::tabus_;
+    using Base::Wake;
+
+public:
+    using Base::Neighbourhood;
+
+public:
+    /**
+     * @brief The maximum length of the moved segment
+     */
+    static constexpr size_t kMaxSegmentLength{ 3 };
+
+public:
+    /**
+     * @brief Calculate the change of the weight caused by moving the segment
+     *
+     * @param tour the tour to evaluate
+     * @param i the first position of the segment
+     * @param length the length of the segment
+     * @param after the position of the city, after which the segment is inserted, outside of the segment
+     * @return int64_t the difference between the new and the old weight
+     */
+    int64_t CalculateDelta(const Tour& tour, size_t i, size_t length, size_t after) const;
+
+    std::array<uint32_t, 4> GetChangedCities(const Tour& tour, const Move& move) const override;
+
+private:
+    /**
+     * @brief Consider moving the segment after the given position
+     *
+     * @param tour the tour to scan
+     * @param aspiration the delta, below which a forbidden move is allowed
+     * @param i the first position of the segment
+     * @param length the length of the segment
+     * @param after the position of the city, after which the segment is inserted
+     * @param delta the change of the weight caused by the move
+     * @param result the best moves to update
+     * @return true if the move is improving
+     * @return false otherwise
+     */
+    bool Check(const Tour& tour, int64_t aspiration, size_t i, size_t length, size_t after, int64_t delta,
+               Candidates& result) const;
+
+    /**
+     * @brief Consider moving the segment after the given position, if it changes the tour
+     *
+     * @param tour the tour to scan
+     * @param aspiration the delta, below which a forbidden move is allowed
+     * @param i the first position of the segment
+     * @param length the length of the segment
+     * @param after the position of the city, after which the segment is inserted
+     * @param result the best moves to update
+     * @return true if the move is improving
+     * @return false otherwise
+     */
+    bool Check(const Tour& tour, int64_t aspiration, size_t i, size_t length, size_t after, Candidates& result) const;
+
+    /**
+     * @brief Consider moving the segment after the positions in [first, last)
+     *
+     * @param tour the tour to scan
+     * @param aspiration the delta, below which a forbidden move is allowed
+     * @param i the first position of the segment
+     * @param length the length of the segment
+     * @param first the first position, after which the segment is inserted
+     * @param last the position after the last one, at most the last position of the tour
+     * @param result the best moves to update
+     * @return true if one of the moves is improving
+     * @return false otherwise
+     */
+    bool CheckRange(const Tour& tour, int64_t aspiration, size_t i, size_t length, size_t first, size_t last,
+                    Candidates& result) const;
+
+protected:
+    bool ScanRow(const Tour& tour, int64_t aspiration, size_t row, Candidates& result) const override;
+    bool ScanCandidateRow(const Tour& tour, int64_t aspiration, size_t row, Candidates& result) const override;
+    void Record(const Tour& tour, const Move& move) override;
+    void Perform(Tour& tour, const Move& move) const override;
+};
+} // namespace tsp::neighbourhood
@@ -0,0 +1,82 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include "tsp/neighbourhood/neighbourhood.hpp"
+
+namespace tsp::neighbourhood
+{
+/**
+ * @brief Neighbourhood exchanging the cities at positions i < j of the tour
+ *
+ * The tabu attribute of the move is the pair of the exchanged cities. With a candidate list, a city is only moved in
+ * front of its nearest successors and behind its nearest predecessors.
+ *
+ * @tparam Distances the representation of the distances between cities
+ */
+template <class Distances> class Swap : public Neighbourhood<Distances>
+{
+private:
+    using Base = Neighbourhood<Distances>;
+    using Base::candidates_;
+    using Base::Consider;
+    using Base::distances_;
+    using Base::edges_;
+    using Base::tabus_;
+    using Base::Wake;
+
+public:
+    using Base::Neighbourhood;
+
+public:
+    /**
+     * @brief Calculate the change of the weight caused by swapping two positions of the tour
+     *
+     * @param tour the tour to evaluate
+     * @param i the first position
+     * @param j the second position
+     * @return int64_t the difference between the new and the old weight
+     */
+    int64_t CalculateDelta(const Tour& tour, size_t i, size_t j) const;
+
+    std::array<uint32_t, 4> GetChangedCities(const Tour& tour, const Move& move) const override;
+
+private:
+    /**
+     * @brief Consider swapping the given positions
+     *
+     * @param tour the tour to scan
+     * @param aspiration the delta, below which a forbidden move is allowed
+     * @param i the first position
+     * @param j the second position
+     * @param delta the change of the weight caused by the move
+     * @param result the best moves to update
+     * @return true if the move is improving
+     * @return false otherwise
+     */
+    bool Check(const Tour& tour, int64_t aspiration, size_t i, size_t j, int64_t delta, Candidates& result) const;
+
+protected:
+    bool ScanRow(const Tour& tour, int64_t aspiration, size_t row, Candidates& result) const override;
+    bool ScanCandidateRow(const Tour& tour, int64_t aspiration, size_t row, Candidates& result) const override;
+    void Record(const Tour& tour, const Move& move) override;
+    void Perform(Tour& tour, const Move& move) const override;
+};
+} // namespace tsp::neighbourhood
@@ -0,0 +1,95 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "tsp/neighbourhood/neighbourhood.hpp"
+
+namespace tsp::neighbourhood
+{
+/**
+ * @brief Neighbourhood reversing the segment of the tour between positions i < j
+ *
+ * The reversed segment changes the direction of its inner edges, so for asymmetric distances the delta uses the
+ * prefix sums of the tour edges in both directions. The tabu attributes of the move are the two removed edges. With
+ * a candidate list, only the reversals connecting a city with one of its nearest neighbours are checked.
+ *
+ * @tparam Distances the representation of the distances between cities
+ */
+template <class Distances> class TwoOpt : public Neighbourhood<Distances>
+{
+private:
+    using Base = Neighbourhood<Distances>;
+    using Base::candidates_;
+    using Base::Consider;
+    using Base::distances_;
+    using Base::edges_;
+    using Base::tabus_;
+    using Base::Wake;
+
+public:
+    using Base::Neighbourhood;
+
+public:
+    void Prepare(const Tour& tour) override;
+
+    /**
+     * @brief Calculate the change of the weight caused by reversing the segment of the prepared tour
+     *
+     * @param tour the tour to evaluate, which should be prepared
+     * @param i the first position of the segment
+     * @param j the last position of the segment
+     * @return int64_t the difference between the new and the old weight
+     */
+    int64_t CalculateDelta(const Tour& tour, size_t i, size_t j) const;
+
+    std::array<uint32_t, 4> GetChangedCities(const Tour& tour, const Move& move) const override;
+
+protected:
+    bool ScanRow(const Tour& tour, int64_t aspiration, size_t row, Candidates& result) const override;
+    bool ScanCandidateRow(const Tour& tour, int64_t aspiration, size_t row, Candidates& result) const override;
+    void Record(const Tour& tour, const Move& move) override;
+    void Perform(Tour& tour, const Move& move) const override;
+
+private:
+    /**
+     * @brief Consider reversing the segment between the given positions
+     *
+     * @param tour the tour to scan
+     * @param aspiration the delta, below which a forbidden move is allowed
+     * @param i the first position of the segment
+     * @param j the last position of the segment
+     * @param delta the change of the weight caused by the move
+     * @param result the best moves to update
+     * @return true if the move is improving
+     * @return false otherwise
+     */
+    bool Check(const Tour& tour, int64_t aspiration, size_t i, size_t j, int64_t delta, Candidates& result) const;
+
+private:
+    // The weights of the edges from the next city to the city at every position of the prepared tour
+    std::vector<uint32_t> backward_edges_;
+
+    // The sums of the weights of the edges before every position, in the direction of the tour and the opposite one
+    std::vector<int64_t> forward_;
+    std::vector<int64_t> backward_;
+};
+} // namespace tsp::neighbourhood
@@ -0,0 +1,167 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace tsp
+{
+/**
+ * @brief Cyclic tour over cities, which keeps both the order of the cities and the position of every city
+ */
+class Tour
+{
+public:
+    using City = uint32_t;
+    using Cities = std::vector<City>;
+    using const_iterator = Cities::const_iterator;
+
+public:
+    Tour() = default;
+
+    /**
+     * @brief Construct a new Tour object
+     *
+     * @param cities the order of the cities, which should be a permutation of [0, size)
+     * @throw std::runtime_error if the cities are not a permutation
+     */
+    explicit Tour(Cities cities);
+
+public:
+    /**
+     * @brief Get the city at the given position without checking the bounds
+     *
+     * @param position the position in the tour
+     * @return City the city
+     */
+    City operator[](size_t position) const noexcept
+    {
+        return cities_[position];
+    }
+
+    /**
+     * @brief Get the city at the given position
+     *
+     * @param position the position in the tour
+     * @return City the city
+     * @throw std::out_of_range if the position is outside of the tour
+     */
+    City at(size_t position) const
+    {
+        return cities_.at(position);
+    }
+
+    /**
+     * @brief Get the position of the given city without checking the bounds
+     *
+     * @param city the city
+     * @return size_t the position of the city in the tour
+     */
+    size_t Position(City city) const noexcept
+    {
+        return positions_[city];
+    }
+
+    /**
+     * @brief Swap the cities at the given positions
+     *
+     * @param i the first position
+     * @param j the second position
+     */
+    void Swap(size_t i, size_t j) noexcept
+    {
+        const auto first = cities_[i];
+        const auto second = cities_[j];
+        cities_[i] = second;
+        cities_[j] = first;
+        positions_[second] = static_cast<uint32_t>(i);
+        positions_[first] = static_cast<uint32_t>(j);
+    }
+
+    /**
+     * @brief Reverse the order of the cities between the given positions
+     *
+     * @param i the first position of the reversed segment
+     * @param j the last position of the reversed segment
+     */
+    void Reverse(size_t i, size_t j) noexcept;
+
+    /**
+     * @brief Move the segment of the cities to another place of the tour, keeping its orientation
+     *
+     * @param first the first position of the segment
+     * @param length the length of the segment
+     * @param after the position of the city, after which the segment should be placed, outside of the segment
+     */
+    void Move(size_t first, size_t length, size_t after) noexcept;
+
+    /**
+     * @brief Shift the cycle, so it starts at the given city, which keeps the same tour
+     *
+     * @param city the city placed at the first position
+     */
+    void Rotate(City city) noexcept;
+
+    size_t size() const noexcept
+    {
+        return cities_.size();
+    }
+
+    bool empty() const noexcept
+    {
+        return cities_.empty();
+    }
+
+    const City* data() const noexcept
+    {
+        return cities_.data();
+    }
+
+    const Cities& GetCities() const noexcept
+    {
+        return cities_;
+    }
+
+    const_iterator begin() const noexcept
+    {
+        return cities_.cbegin();
+    }
+
+    const_iterator end() const noexcept
+    {
+        return cities_.cend();
+    }
+
+private:
+    /**
+     * @brief Update the positions of the cities in the given range of the positions
+     *
+     * @param first the first position to update
+     * @param last the position after the last one to update
+     */
+    void UpdatePositions(size_t first, size_t last) noexcept;
+
+private:
+    Cities cities_;
+    std::vector<uint32_t> positions_;
+};
+} // namespace tsp
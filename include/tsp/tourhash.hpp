@@ -0,0 +1,75 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "tsp/tour.hpp"
+
+namespace tsp
+{
+/**
+ * @brief Zobrist-style hash of a tour, the XOR of the keys of its edges
+ *
+ * The key of an edge does not depend on its direction, so a move changing a few edges updates the hash in O(1): the
+ * keys of the edges around the changed cities are removed before the move and added after it.
+ */
+class TourHash
+{
+public:
+    /**
+     * @brief Construct a new TourHash object
+     *
+     * @param cities the amount of the cities
+     * @param seed the seed of the random keys of the cities
+     */
+    TourHash(uint32_t cities, uint64_t seed);
+
+public:
+    /**
+     * @brief Calculate the hash of the whole tour in O(n)
+     *
+     * @param tour the tour
+     * @return uint64_t the hash
+     */
+    uint64_t operator()(const Tour& tour) const noexcept;
+
+    /**
+     * @brief Calculate the XOR of the keys of the edges touching any of the given cities, every edge counted once
+     *
+     * @param tour the tour
+     * @param cities up to four cities, which may repeat
+     * @return uint64_t the XOR of the keys
+     */
+    uint64_t Incident(const Tour& tour, std::span<const uint32_t> cities) const noexcept;
+
+private:
+    uint64_t GetKey(uint32_t first, uint32_t second) const noexcept;
+
+private:
+    // The largest amount of the cities, whose edges are hashed by a single call of Incident
+    static constexpr size_t kMaxCities{ 4 };
+
+private:
+    std::vector<uint64_t> keys_;
+};
+} // namespace tsp
@@ -0,0 +1,97 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+
+#include "utils/cancellationtoken.hpp"
+
+namespace utils
+{
+/**
+ * @brief Deadline of a loop, which reads the clock only every k iterations
+ *
+ * The amount of the iterations between the reads is calibrated from the measured time of an iteration, so the loop
+ * ends at most about the given overshoot after the deadline, while short iterations read the clock rarely.
+ */
+class Deadline
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+public:
+    /**
+     * @brief Construct a new Deadline object, which starts counting at once
+     *
+     * @param limit the time after which the deadline expires
+     * @param max_overshoot the time, by which the loop may run past the deadline
+     * @param token the token, which may stop the loop earlier, nullptr if the loop cannot be cancelled
+     */
+    Deadline(Clock::duration limit, Clock::duration max_overshoot,
+             std::shared_ptr<const CancellationToken> token = nullptr);
+
+public:
+    /**
+     * @brief Check whether the loop should stop, it should be called once per iteration
+     *
+     * @return true if the deadline passed or the loop was cancelled
+     * @return false otherwise
+     */
+    bool IsExpired() noexcept
+    {
+        if (token_ != nullptr && token_->IsCancelled())
+        {
+            return true;
+        }
+
+        return --countdown_ == 0 ? Check() : expired_;
+    }
+
+    /**
+     * @brief Get the current amount of the iterations between the reads of the clock
+     *
+     * @return uint32_t the amount of the iterations
+     */
+    uint32_t GetStride() const noexcept
+    {
+        return stride_;
+    }
+
+private:
+    bool Check() noexcept;
+
+private:
+    // The limits of the amount of the iterations between the reads and of its growth after a single read
+    static constexpr uint32_t kMaxStride{ 1U << 20 };
+    static constexpr uint32_t kMaxGrowth{ 2 };
+
+private:
+    const Clock::time_point end_;
+    const Clock::duration max_overshoot_;
+    std::shared_ptr<const CancellationToken> token_;
+
+    Clock::time_point last_check_;
+    uint32_t stride_{ 1 };
+    uint32_t countdown_{ 1 };
+    bool expired_{};
+};
+} // namespace utils
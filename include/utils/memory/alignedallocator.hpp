@@ -0,0 +1,73 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <new>
+
+namespace utils::memory
+{
+/**
+ * @brief The size of the cache line, which is used as the default alignment
+ */
+constexpr size_t kCacheLineSize{ 64 };
+
+/**
+ * @brief Allocator, which places the allocated blocks on the given boundary
+ *
+ * @tparam T the type of the allocated values
+ * @tparam Alignment the alignment of the allocated blocks in bytes
+ */
+template <class T, size_t Alignment = kCacheLineSize> class AlignedAllocator
+{
+    static_assert(Alignment >= alignof(T), "The alignment is smaller than the alignment of the type");
+
+public:
+    using value_type = T;
+
+    template <class U> struct rebind
+    {
+        using other = AlignedAllocator<U, Alignment>;
+    };
+
+public:
+    AlignedAllocator() noexcept = default;
+
+    template <class U> AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept
+    {
+    }
+
+public:
+    T* allocate(size_t count)
+    {
+        return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t{ Alignment }));
+    }
+
+    void deallocate(T* pointer, size_t) noexcept
+    {
+        ::operator delete(pointer, std::align_val_t{ Alignment });
+    }
+
+    template <class U> bool operator==(const AlignedAllocator<U, Alignment>&) const noexcept
+    {
+        return true;
+    }
+};
+} // namespace utils::memory
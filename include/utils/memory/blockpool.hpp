@@ -0,0 +1,89 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace utils::memory
+{
+/**
+ * @brief Thread-safe pool of the blocks of a single size, which are carved from large chunks and reused through a free
+ * list, so the short-lived objects of a runtime-known size avoid the general-purpose allocator
+ */
+class BlockPool
+{
+public:
+    /**
+     * @brief Construct a new BlockPool object
+     *
+     * @param block_size the size of every block in bytes, it is rounded up to the alignment
+     * @param chunk_blocks the amount of the blocks allocated at once
+     */
+    explicit BlockPool(size_t block_size, size_t chunk_blocks = 1024);
+
+    BlockPool(const BlockPool&) = delete;
+    BlockPool& operator=(const BlockPool&) = delete;
+
+public:
+    /**
+     * @brief Take a block from the pool, the block is aligned to alignof(std::max_align_t)
+     *
+     * @return void* the uninitialised block
+     */
+    void* Allocate();
+
+    /**
+     * @brief Return the block to the pool
+     *
+     * @param block the block taken by Allocate()
+     */
+    void Deallocate(void* block) noexcept;
+
+    /**
+     * @brief Get the amount of the blocks taken and not returned yet
+     *
+     * @return size_t the amount of the blocks in use
+     */
+    size_t GetUsed() const noexcept;
+
+    size_t GetBlockSize() const noexcept
+    {
+        return block_size_;
+    }
+
+private:
+    // The header of the free block, which links it to the next one
+    struct FreeBlock
+    {
+        FreeBlock* next;
+    };
+
+private:
+    const size_t block_size_;
+    const size_t chunk_blocks_;
+
+    mutable std::mutex mutex_;
+    std::vector<std::unique_ptr<std::byte[]>> chunks_;
+    FreeBlock* free_{};
+    size_t used_{};
+};
+} // namespace utils::memory
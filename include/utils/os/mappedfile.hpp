@@ -0,0 +1,71 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace utils::os
+{
+/**
+ * @brief Read-only view of the whole file, which is mapped into the memory instead of being copied
+ *
+ * On the systems without mmap the file is read into a buffer owned by the object.
+ */
+class MappedFile
+{
+public:
+    /**
+     * @brief Map the given file
+     *
+     * @param path the path to the file
+     * @throw std::runtime_error if the file cannot be opened or mapped
+     */
+    explicit MappedFile(const std::string& path);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+public:
+    const char* data() const noexcept
+    {
+        return data_;
+    }
+
+    size_t size() const noexcept
+    {
+        return size_;
+    }
+
+    std::string_view View() const noexcept
+    {
+        return { data_, size_ };
+    }
+
+private:
+    const char* data_{};
+    size_t size_{};
+
+    // The content of the file, when it could not be mapped
+    std::string buffer_;
+};
+} // namespace utils::os
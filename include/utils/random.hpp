@@ -0,0 +1,115 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include <bit>
+#include <cstdint>
+#include <limits>
+
+namespace utils
+{
+/**
+ * @brief Small and fast generator of random numbers (xoshiro256**), every solver owns its own one
+ *
+ * The sequence depends only on the seed, so a run may be replayed with the seed written to its results. It satisfies
+ * the UniformRandomBitGenerator requirements.
+ */
+class Random
+{
+public:
+    using result_type = uint64_t;
+
+public:
+    /**
+     * @brief Construct a new Random object
+     *
+     * @param seed the seed, which is expanded into the state with SplitMix64
+     */
+    explicit Random(uint64_t seed = 0) noexcept
+    {
+        for (auto& word : state_)
+        {
+            word = SplitMix(seed);
+        }
+    }
+
+public:
+    result_type operator()() noexcept
+    {
+        const auto result = std::rotl(state_[1] * 5, 7) * 9;
+        const auto shifted = state_[1] << 17;
+
+        state_[2] ^= state_[0];
+        state_[3] ^= state_[1];
+        state_[1] ^= state_[2];
+        state_[0] ^= state_[3];
+        state_[2] ^= shifted;
+        state_[3] = std::rotl(state_[3], 45);
+
+        return result;
+    }
+
+    /**
+     * @brief Draw a number from [0, bound) with a single output of the generator
+     *
+     * @param bound the exclusive upper bound
+     * @return uint32_t the number
+     */
+    uint32_t Bounded(uint32_t bound) noexcept
+    {
+        return static_cast<uint32_t>(((operator()() >> 32) * bound) >> 32);
+    }
+
+    /**
+     * @brief Derive the seed of a single run from the base seed, the neighbouring runs get unrelated sequences
+     *
+     * @param seed the base seed
+     * @param stream the number of the run
+     * @return uint64_t the seed of the run
+     */
+    static uint64_t Derive(uint64_t seed, uint64_t stream) noexcept
+    {
+        uint64_t state{ seed ^ (stream * 0xD1B54A32D192ED03ULL) };
+        return SplitMix(state);
+    }
+
+    static constexpr result_type min() noexcept
+    {
+        return std::numeric_limits<result_type>::min();
+    }
+
+    static constexpr result_type max() noexcept
+    {
+        return std::numeric_limits<result_type>::max();
+    }
+
+private:
+    static uint64_t SplitMix(uint64_t& state) noexcept
+    {
+        auto value = (state += 0x9E3779B97F4A7C15ULL);
+        value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+        return value ^ (value >> 31);
+    }
+
+private:
+    uint64_t state_[4];
+};
+} // namespace utils
@@ -0,0 +1,194 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "utils/memory/alignedallocator.hpp"
+
+namespace utils
+{
+/**
+ * @brief Fixed-size pool of worker threads, which balance the tasks by stealing them from each other
+ *
+ * The tasks submitted from outside of the pool are executed in the order of submission. A task may split itself by
+ * submitting sub-tasks, which go to the queue of its worker and are stolen by the idle workers, and wait for them with
+ * Join, which executes the sub-tasks not stolen yet.
+ */
+class ThreadPool
+{
+public:
+    struct Statistics
+    {
+        // The time spent on the tasks, a task executed while waiting inside another one is counted once
+        std::chrono::nanoseconds busy{};
+
+        // The amount of the executed tasks
+        uint64_t tasks{};
+
+        // The amount of the tasks taken from the queues of the other workers
+        uint64_t stolen{};
+    };
+
+    struct Report
+    {
+        // The time since the pool was created until all the workers stopped
+        std::chrono::nanoseconds lifetime{};
+
+        std::vector<Statistics> workers;
+    };
+
+public:
+    /**
+     * @brief Construct a new ThreadPool object
+     *
+     * @param threads the amount of worker threads, zero means the amount of hardware threads
+     */
+    explicit ThreadPool(size_t threads = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+public:
+    /**
+     * @brief Schedule the task for the execution
+     *
+     * @tparam Task the type of the callable
+     * @param task the callable to execute
+     * @return std::future with the result of the task
+     */
+    template <class Task> auto Submit(Task&& task) -> std::future<std::invoke_result_t<std::decay_t<Task>>>
+    {
+        using Result = std::invoke_result_t<std::decay_t<Task>>;
+
+        // std::function requires a copyable callable, so the packaged task is shared
+        auto packaged = std::make_shared<std::packaged_task<Result()>>(std::forward<Task>(task));
+        auto future = packaged->get_future();
+        Push([packaged]() { (*packaged)(); });
+
+        return future;
+    }
+
+    /**
+     * @brief Wait for the result of a task, a worker executes its queued sub-tasks in the meantime
+     *
+     * @tparam Result the type of the result
+     * @param future the future returned by Submit
+     * @return Result the result of the task
+     */
+    template <class Result> Result Join(std::future<Result> future)
+    {
+        while (future.wait_for(std::chrono::seconds{ 0 }) != std::future_status::ready)
+        {
+            if (!Help())
+            {
+                future.wait_for(kHelpInterval);
+            }
+        }
+
+        return future.get();
+    }
+
+    /**
+     * @brief Execute the remaining tasks, stop the workers and report their work
+     *
+     * @return Report the statistics of every worker
+     */
+    Report Shutdown();
+
+    size_t Size() const noexcept
+    {
+        return queues_.size();
+    }
+
+private:
+    using Task = std::function<void()>;
+
+    struct alignas(memory::kCacheLineSize) Worker
+    {
+        // The owner takes the newest task, while the thieves take the oldest one
+        std::mutex mutex;
+        std::deque<Task> tasks;
+
+        // Written only by the thread of the worker
+        Statistics statistics;
+    };
+
+    // The time, after which a waiting worker checks the queues again
+    static constexpr std::chrono::milliseconds kHelpInterval{ 1 };
+
+private:
+    void Push(Task task);
+
+    /**
+     * @brief Take the newest task from the queue of the worker
+     *
+     * @param worker the index of the worker
+     * @return Task the task, empty if the queue is empty
+     */
+    Task TakeOwn(size_t worker);
+
+    /**
+     * @brief Take a task for the worker: the newest one of its own, a stolen one or the oldest submitted one
+     *
+     * @param worker the index of the worker
+     * @return Task the task, empty if there are no tasks
+     */
+    Task Take(size_t worker);
+
+    /**
+     * @brief Execute one of the sub-tasks of the current worker
+     *
+     * @return true if a task was executed
+     * @return false if there are no tasks or the calling thread is not a worker of this pool
+     */
+    bool Help();
+
+    void Work(size_t worker);
+
+private:
+    std::vector<std::unique_ptr<Worker>> queues_;
+    std::vector<std::thread> threads_;
+
+    // The tasks submitted from outside of the pool and the amount of all the queued tasks
+    std::deque<Task> submitted_;
+    size_t pending_{};
+
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    bool stopped_{};
+
+    const std::chrono::steady_clock::time_point start_;
+    Report report_;
+};
+} // namespace utils
@@ -19,17 +19,147 @@
 
 #pragma once
 
-#include <deque>
+#include <charconv>
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
 #include <string>
+#include <string_view>
+#include <system_error>
 
 namespace utils
 {
+/**
+ * @brief Lazy range over the tokens of a single buffer, the tokens are views into the buffer
+ *
+ * The tokens are separated by the delimiter, trimmed of the whitespace and the empty ones are skipped. A whitespace
+ * delimiter splits the buffer on every run of any whitespace.
+ */
 class Tokenizer
 {
 public:
-    using Tokens = std::deque<std::string>;
+    class Iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::string_view;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const std::string_view*;
+        using reference = const std::string_view&;
+
+    public:
+        Iterator() = default;
+        Iterator(std::string_view rest, char delimiter) : rest_{ rest }, delimiter_{ delimiter }
+        {
+            Advance();
+        }
+
+    public:
+        reference operator*() const noexcept
+        {
+            return token_;
+        }
+
+        pointer operator->() const noexcept
+        {
+            return &token_;
+        }
+
+        Iterator& operator++()
+        {
+            Advance();
+            return *this;
+        }
+
+        Iterator operator++(int)
+        {
+            auto result = *this;
+            Advance();
+            return result;
+        }
+
+        bool operator==(const Iterator& another) const noexcept
+        {
+            return token_.data() == another.token_.data();
+        }
+
+        /**
+         * @brief Get the part of the buffer after the current token
+         *
+         * @return std::string_view the remaining buffer
+         */
+        std::string_view Rest() const noexcept
+        {
+            return rest_;
+        }
+
+    private:
+        void Advance() noexcept;
+
+    private:
+        std::string_view token_;
+        std::string_view rest_;
+        char delimiter_{};
+    };
+
+public:
+    /**
+     * @brief Construct a new Tokenizer object
+     *
+     * @param buffer the buffer to split, which has to outlive the tokens
+     * @param delimiter the character separating the tokens
+     */
+    explicit Tokenizer(std::string_view buffer, char delimiter = ' ') : buffer_{ buffer }, delimiter_{ delimiter }
+    {
+    }
+
+public:
+    Iterator begin() const
+    {
+        return { buffer_, delimiter_ };
+    }
+
+    Iterator end() const noexcept
+    {
+        return {};
+    }
 
 public:
-    static Tokens tokenize(std::string line, char delimiter);
+    static bool IsWhitespace(char value) noexcept
+    {
+        return value == ' ' || value == '\t' || value == '\n' || value == '\r' || value == '\v' || value == '\f';
+    }
+
+    /**
+     * @brief Remove the whitespace from both ends of the value
+     *
+     * @param value the value to trim
+     * @return std::string_view the trimmed view into the value
+     */
+    static std::string_view Trim(std::string_view value) noexcept;
+
+    /**
+     * @brief Parse the whole token as a number
+     *
+     * @tparam T the type of the number
+     * @param token the token
+     * @return T the number
+     * @throw std::runtime_error if the token is not a valid number of the type
+     */
+    template <class T> static T Parse(std::string_view token)
+    {
+        T value{};
+        const auto [end, error] = std::from_chars(token.data(), token.data() + token.size(), value);
+        if (error != std::errc{} || end != token.data() + token.size())
+        {
+            throw std::runtime_error("Value " + std::string{ token } + " is not a valid number");
+        }
+
+        return value;
+    }
+
+private:
+    std::string_view buffer_;
+    char delimiter_;
 };
-} // namespace utils
\ No newline at end of file
+} // namespace utils
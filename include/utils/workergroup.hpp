@@ -0,0 +1,90 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace utils
+{
+/**
+ * @brief Persistent group of threads, which execute the same job together with the calling thread
+ *
+ * The threads are created once and wait for the next job between the calls, so a job may be as short as a few
+ * microseconds. Only one thread should call Run at a time.
+ */
+class WorkerGroup
+{
+public:
+    using Job = std::function<void(size_t worker)>;
+
+public:
+    /**
+     * @brief Construct a new WorkerGroup object
+     *
+     * @param size the amount of workers including the calling thread, zero means the amount of hardware threads
+     */
+    explicit WorkerGroup(size_t size = 0);
+    ~WorkerGroup();
+
+    WorkerGroup(const WorkerGroup&) = delete;
+    WorkerGroup& operator=(const WorkerGroup&) = delete;
+
+public:
+    /**
+     * @brief Execute the job on every worker and wait for all of them to finish
+     *
+     * @param job the job, which receives the index of the worker in [0, Size())
+     * @throw the first exception thrown by the job on any worker, after all of them finished
+     */
+    void Run(const Job& job);
+
+    size_t Size() const noexcept
+    {
+        return threads_.size() + 1;
+    }
+
+private:
+    void Work(size_t worker);
+
+    /**
+     * @brief Keep the exception being handled, unless another worker failed first
+     */
+    void Capture() noexcept;
+
+private:
+    std::vector<std::thread> threads_;
+
+    const Job* job_{};
+    std::atomic<uint64_t> generation_{};
+    std::atomic<size_t> pending_{};
+    std::atomic<bool> stopped_{};
+
+    // The first exception thrown by the current job, which is passed on to the caller of Run
+    std::mutex error_mutex_;
+    std::exception_ptr error_;
+};
+} // namespace utils
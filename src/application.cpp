@@ -23,9 +23,25 @@
 #include "utils/os/memory.hpp"
 #endif
 
+#include <algorithm>
 #include <chrono>
+#include <functional>
+#include <future>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <tuple>
+#include <variant>
+#include <vector>
 
+#include "io/instancecache.hpp"
+#include "tsp/algorithm/branchandbound.hpp"
+#include "tsp/algorithm/heldkarp.hpp"
 #include "tsp/algorithm/ts.hpp"
+#include "tsp/kernels.hpp"
+#include "utils/random.hpp"
+#include "utils/threadpool.hpp"
 
 Application::Application(const std::string& config_file)
 {
@@ -50,52 +66,340 @@ Application::~Application()
 
 void Application::Start()
 {
-    math::Matrix<uint32_t> positions;
+    struct TestCase
+    {
+        std::string name;
+        std::vector<std::future<Result>> results;
+    };
+
+    // A single repeat, which is scheduled after all the instances are loaded
+    struct Run
+    {
+        size_t test_case;
+        size_t repeat;
+        std::chrono::milliseconds time_limit;
+        size_t cities;
+        std::function<Result()> solve;
+    };
+
+    std::vector<TestCase> test_cases;
+    std::vector<Run> runs;
+    utils::ThreadPool pool{ GetThreadsCount() };
+
+    // The instruction set of the kernels may be lowered to compare the implementations
+    const auto settings = std::find_if(parameters_.sections.cbegin(), parameters_.sections.cend(),
+                                       [](const auto& section) { return section.name == "settings"; });
+    if (settings != parameters_.sections.cend() && settings->properties.contains("kernels"))
+    {
+        tsp::kernels::SetLevel(tsp::kernels::ParseLevel(settings->properties.at("kernels")));
+    }
+
+    // The parsed instances are kept in a binary form, unless the cache is disabled
+    std::string cache_directory{ kCacheDirectory };
+    if (settings != parameters_.sections.cend() && settings->properties.contains("cache"))
+    {
+        cache_directory = settings->properties.at("cache");
+    }
+
+    // The instances given by the coordinates may keep the distances to the nearest neighbours of every city
+    uint32_t cached_neighbours{};
+    if (settings != parameters_.sections.cend() && settings->properties.contains("distance_cache"))
+    {
+        cached_neighbours = static_cast<uint32_t>(std::stoul(settings->properties.at("distance_cache")));
+    }
+    io::InstanceCache cache{ cache_directory == "none" ? std::string{} : cache_directory, cached_neighbours };
+    uint32_t section_index{};
 
     for (const auto& section : parameters_.sections)
     {
-        // Skip the output section as it was checked already
-        if (section.name == "output")
+        // Skip the sections which configure the application as they were checked already
+        if (!IsTestCase(section))
         {
             continue;
         }
 
-        // Save the name of the section to the output
-        output_file_ << section.name << std::endl;
+        ++section_index;
+        auto& test_case = test_cases.emplace_back();
+        test_case.name = section.name;
 
-        io::Reader<io::FileTypes::kAtsp> reader(section.properties.at("filename"));
-        positions = reader.Read().positions;
+        // The distances are stored in the smallest representation and shared read-only between all the repeats
+        const auto distances = cache.Load(section.properties.at("filename"));
 
-        for (uint32_t index{ 1 }; index <= std::stoi(section.properties.at("count")); ++index)
+        auto parameters = GetSolverParameters(section);
+        if (section.properties.contains("candidates"))
         {
-            tsp::algorithm::TS tsp{ positions, std::stoul(section.properties.at("max_tabu")),
-                                    std::stoi(section.properties.at("max_iterations")),
-                                    std::chrono::milliseconds(std::stoi(section.properties.at("time_limit"))) };
+            // The candidate list depends only on the instance, so it is shared between the repeats
+            const auto size = static_cast<uint32_t>(std::stoul(section.properties.at("candidates")));
+            parameters.candidates = std::make_shared<const tsp::CandidateList>(*distances, size);
+        }
+
+        const auto seeds = GetSeeds(section, section_index);
+        const auto cities = std::visit([](const auto& representation) { return representation.Size(); }, *distances);
 
-            const auto start_point = std::chrono::system_clock::now();
-            const auto solution = tsp.Solve();
-            const auto end_point = std::chrono::system_clock::now();
+        // The small instances are solved exactly, which takes less than the time limit of the search
+        const auto exact_cities = section.properties.contains("exact_cities")
+                                      ? std::stoul(section.properties.at("exact_cities"))
+                                      : kExactCities;
+        const bool exact = cities <= std::min<size_t>(exact_cities, tsp::algorithm::HeldKarp::kMaxCities);
+        const auto time_limit = exact ? std::chrono::milliseconds{} : parameters.time_limit;
 
+        // The exact solution does not depend on the seed, so it is computed and written only once
+        const auto repeats = exact ? std::min<size_t>(seeds.size(), 1) : seeds.size();
+        test_case.results.resize(repeats);
+
+        // The larger ones may be solved by the branch and bound, which proves the optimum or bounds the gap in time
+        const auto branch_cities = section.properties.contains("branch_cities")
+                                       ? std::stoul(section.properties.at("branch_cities"))
+                                       : size_t{};
+        const bool branch =
+            !exact && cities <= std::min<size_t>(branch_cities, tsp::algorithm::BranchAndBound::kMaxCities);
+        const auto order = section.properties.contains("branch_order")
+                               ? tsp::algorithm::ParseOrder(section.properties.at("branch_order"))
+                               : tsp::algorithm::Order::kBestFirst;
+        for (size_t repeat{}; repeat < repeats; ++repeat)
+        {
+            // Every run gets its own stream of random numbers, which is written to the results
+            auto run_parameters = parameters;
+            run_parameters.seed = seeds[repeat];
+            run_parameters.scheduler = &pool;
+
+            auto solve = [=]() {
+                std::unique_ptr<tsp::algorithm::Algorithm> solver;
+                if (exact)
+                {
+                    solver = std::make_unique<tsp::algorithm::HeldKarp>(distances, run_parameters.threads);
+                }
+                else if (branch)
+                {
+                    solver = std::make_unique<tsp::algorithm::BranchAndBound>(distances, run_parameters, order);
+                }
+                else
+                {
+                    solver = std::make_unique<tsp::algorithm::TS>(distances, run_parameters);
+                }
+
+                const auto start_point = std::chrono::system_clock::now();
+                auto solution = solver->Solve();
+                const auto end_point = std::chrono::system_clock::now();
+
+                Result result;
+                result.duration = std::chrono::duration_cast<std::chrono::microseconds>(end_point - start_point);
 #if defined(__linux__) || defined(__linux) || defined(linux) || defined(__gnu_linux__)
-            // Write out the results of the calculation
-            output_file_ << std::chrono::duration_cast<std::chrono::microseconds>(end_point - start_point).count()
-                         << "," << utils::os::getProcessVirtualMemorySize() << ", ";
-#else
-            // Store the duration of the operation
-            output_file_ << std::chrono::duration_cast<std::chrono::microseconds>(end_point - start_point).count()
-                         << ", ";
+                result.memory = utils::os::getProcessVirtualMemorySize();
 #endif
+                result.solution = std::move(solution);
+                result.seed = run_parameters.seed;
+                return result;
+            };
+            runs.push_back({ test_cases.size() - 1, repeat, time_limit, cities, std::move(solve) });
+        }
+    }
 
-            // Write the result of the calculation into the file
-            for (const auto point : solution.path)
-            {
-                output_file_ << point << " -> ";
-            }
+    // The longest runs start first, so the short ones fill the idle workers at the end of the batch
+    const auto is_longer = [](const Run& first, const Run& second) {
+        return std::tie(first.time_limit, first.cities) > std::tie(second.time_limit, second.cities);
+    };
+    std::stable_sort(runs.begin(), runs.end(), is_longer);
+    for (auto& run : runs)
+    {
+        test_cases[run.test_case].results[run.repeat] = pool.Submit(std::move(run.solve));
+    }
 
-            output_file_ << solution.path.at(0) << ", " << solution.weight << std::endl;
+    // The results are written in the order of the config, regardless of the order of the completion
+    for (auto& test_case : test_cases)
+    {
+        // Save the name of the section to the output
+        output_file_ << test_case.name << std::endl;
+
+        for (size_t repeat{}; repeat < test_case.results.size(); ++repeat)
+        {
+            const auto result = test_case.results[repeat].get();
+            WriteResult(result);
+            WriteBound(test_case.name, repeat, result.solution);
         }
 
         // Visually separate the sections
         output_file_ << std::endl;
     }
-}
\ No newline at end of file
+
+    WriteUtilisation(pool.Shutdown());
+}
+
+bool Application::IsTestCase(const io::Reader<io::FileTypes::kIni>::Parameters::Section& section)
+{
+    return section.name != "output" && section.name != "settings";
+}
+
+size_t Application::GetThreadsCount() const
+{
+    auto iterator = std::find_if(parameters_.sections.cbegin(), parameters_.sections.cend(),
+                                 [](const auto& section) { return section.name == "settings"; });
+    if (iterator == parameters_.sections.cend() || !iterator->properties.contains("threads"))
+    {
+        // The repeats are independent, so by default they run on the whole machine
+        return std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    return std::stoul(iterator->properties.at("threads"));
+}
+
+std::vector<uint64_t> Application::GetSeeds(const io::Reader<io::FileTypes::kIni>::Parameters::Section& section,
+                                            uint32_t section_index)
+{
+    const auto count = std::stoul(section.properties.at("count"));
+    std::vector<uint64_t> seeds;
+
+    // The seeds of the runs written to the results replay them exactly
+    if (section.properties.contains("seeds"))
+    {
+        for (const auto seed : utils::Tokenizer{ section.properties.at("seeds"), ',' })
+        {
+            seeds.push_back(utils::Tokenizer::Parse<uint64_t>(seed));
+        }
+        if (seeds.size() != count)
+        {
+            throw std::runtime_error("The amount of the seeds of " + section.name + " differs from the count");
+        }
+
+        return seeds;
+    }
+
+    // Otherwise the seed of every run is derived from the base seed, which defaults to the number of the section
+    const auto base = section.properties.contains("seed") ? std::stoull(section.properties.at("seed")) : section_index;
+    for (uint64_t index{ 1 }; index <= count; ++index)
+    {
+        seeds.push_back(utils::Random::Derive(base, index));
+    }
+
+    return seeds;
+}
+
+tsp::algorithm::TS::Parameters Application::GetSolverParameters(
+    const io::Reader<io::FileTypes::kIni>::Parameters::Section& section)
+{
+    tsp::algorithm::TS::Parameters parameters;
+    parameters.max_tabu = std::stoul(section.properties.at("max_tabu"));
+    parameters.max_iterations = static_cast<uint32_t>(std::stoul(section.properties.at("max_iterations")));
+    parameters.time_limit = std::chrono::milliseconds(std::stoi(section.properties.at("time_limit")));
+
+    if (section.properties.contains("max_overshoot"))
+    {
+        parameters.max_overshoot = std::chrono::microseconds(std::stoi(section.properties.at("max_overshoot")));
+    }
+
+    if (section.properties.contains("neighbourhood_threads"))
+    {
+        parameters.threads = std::stoul(section.properties.at("neighbourhood_threads"));
+    }
+
+    if (section.properties.contains("dont_look_bits"))
+    {
+        parameters.dont_look_bits = std::stoi(section.properties.at("dont_look_bits")) != 0;
+    }
+
+    if (section.properties.contains("construction"))
+    {
+        parameters.construction = tsp::construction::ParseType(section.properties.at("construction"));
+    }
+
+    if (section.properties.contains("construction_roots"))
+    {
+        parameters.construction_roots = static_cast<uint32_t>(std::stoul(section.properties.at("construction_roots")));
+    }
+
+    if (section.properties.contains("reactive"))
+    {
+        parameters.reactive = std::stoi(section.properties.at("reactive")) != 0;
+    }
+
+    if (section.properties.contains("restart"))
+    {
+        parameters.restart = tsp::algorithm::ParseRestart(section.properties.at("restart"));
+    }
+
+    if (section.properties.contains("elite"))
+    {
+        parameters.elite = std::stoul(section.properties.at("elite"));
+    }
+
+    if (section.properties.contains("islands"))
+    {
+        parameters.islands = std::stoul(section.properties.at("islands"));
+    }
+
+    if (section.properties.contains("exchange_interval"))
+    {
+        parameters.exchange_interval = static_cast<uint32_t>(std::stoul(section.properties.at("exchange_interval")));
+    }
+
+    if (section.properties.contains("neighbourhood"))
+    {
+        parameters.neighbourhoods.clear();
+        for (const auto name : utils::Tokenizer{ section.properties.at("neighbourhood"), ',' })
+        {
+            parameters.neighbourhoods.push_back(tsp::neighbourhood::ParseType(std::string{ name }));
+        }
+    }
+
+    return parameters;
+}
+
+void Application::WriteUtilisation(const utils::ThreadPool::Report& report)
+{
+    const auto lifetime = std::max(report.lifetime.count(), int64_t{ 1 });
+    const auto percent = [lifetime](std::chrono::nanoseconds busy) { return 100.0 * busy.count() / lifetime; };
+
+    std::chrono::nanoseconds busy{};
+    std::cerr << std::fixed << std::setprecision(1);
+    for (size_t worker{}; worker < report.workers.size(); ++worker)
+    {
+        const auto& statistics = report.workers[worker];
+        std::cerr << "Worker " << worker << ": " << percent(statistics.busy) << "% busy, " << statistics.tasks
+                  << " tasks, " << statistics.stolen << " stolen" << std::endl;
+        busy += statistics.busy;
+    }
+
+    const auto workers = static_cast<int64_t>(std::max<size_t>(report.workers.size(), 1));
+    std::cerr << "Utilisation: " << percent(busy / workers) << "% of " << report.workers.size() << " workers in "
+              << std::chrono::duration<double>(report.lifetime).count() << " s" << std::endl;
+}
+
+void Application::WriteBound(const std::string& name, size_t repeat,
+                             const tsp::algorithm::Algorithm::Solution& solution)
+{
+    if (!solution.bound.has_value())
+    {
+        return;
+    }
+
+    std::cerr << name << " #" << repeat + 1 << ": ";
+    if (*solution.bound >= solution.weight)
+    {
+        std::cerr << "optimal" << std::endl;
+        return;
+    }
+
+    const auto gap = 100.0 * (solution.weight - *solution.bound) / solution.weight;
+    std::cerr << std::fixed << std::setprecision(2) << "gap " << gap << "% (lower bound " << *solution.bound << ")"
+              << std::endl;
+}
+
+void Application::WriteResult(const Result& result)
+{
+#if defined(__linux__) || defined(__linux) || defined(linux) || defined(__gnu_linux__)
+    // Write out the results of the calculation
+    output_file_ << result.duration.count() << "," << result.memory << "," << result.seed << ", ";
+#else
+    // Store the duration of the operation
+    output_file_ << result.duration.count() << "," << result.seed << ", ";
+#endif
+
+    // Write the result of the calculation into the file
+    const auto& solution = result.solution;
+    for (const auto point : solution.path)
+    {
+        output_file_ << point << " -> ";
+    }
+
+    output_file_ << solution.path.at(0) << ", " << solution.weight << std::endl;
+}
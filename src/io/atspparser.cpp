@@ -0,0 +1,337 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "io/atspparser.hpp"
+
+#include <cctype>
+#include <stdexcept>
+
+#include "utils/tokenizer.hpp"
+
+namespace io
+{
+void AtspParser::Feed(std::string_view chunk)
+{
+    while (!chunk.empty() && stage_ == Stage::kSpecification)
+    {
+        const auto end = chunk.find('\n');
+        if (end == std::string_view::npos)
+        {
+            pending_.append(chunk);
+            return;
+        }
+
+        pending_.append(chunk.substr(0, end));
+        chunk.remove_prefix(end + 1);
+
+        const std::string line{ std::move(pending_) };
+        pending_.clear();
+        ProcessLine(utils::Tokenizer::Trim(line));
+    }
+
+    if (!IsSection() || chunk.empty())
+    {
+        return;
+    }
+
+    // The token split by the previous chunk continues at the beginning of this one
+    if (!pending_.empty())
+    {
+        size_t end{};
+        while (end < chunk.size() && !utils::Tokenizer::IsWhitespace(chunk[end]))
+        {
+            ++end;
+        }
+
+        pending_.append(chunk.substr(0, end));
+        if (pending_.size() > kMaxTokenSize)
+        {
+            throw std::runtime_error("The given file has an invalid value " + pending_.substr(0, kMaxTokenSize));
+        }
+        chunk.remove_prefix(end);
+        if (chunk.empty())
+        {
+            return;
+        }
+
+        ProcessToken(pending_);
+        pending_.clear();
+    }
+
+    // The last token may continue in the next chunk
+    size_t last{ chunk.size() };
+    while (last > 0 && !utils::Tokenizer::IsWhitespace(chunk[last - 1]))
+    {
+        --last;
+    }
+    pending_.assign(chunk.substr(last));
+    if (pending_.size() > kMaxTokenSize)
+    {
+        throw std::runtime_error("The given file has an invalid value " + pending_.substr(0, kMaxTokenSize));
+    }
+
+    for (const auto token : utils::Tokenizer{ chunk.substr(0, last) })
+    {
+        if (!IsSection())
+        {
+            break;
+        }
+
+        ProcessToken(token);
+    }
+}
+
+AtspParser::Instance AtspParser::Finish()
+{
+    if (stage_ == Stage::kSpecification && !pending_.empty())
+    {
+        const std::string line{ std::move(pending_) };
+        pending_.clear();
+        ProcessLine(utils::Tokenizer::Trim(line));
+    }
+
+    if (IsSection() && !pending_.empty())
+    {
+        ProcessToken(pending_);
+        pending_.clear();
+    }
+
+    if (stage_ == Stage::kSpecification)
+    {
+        if (dimension_ == 0)
+        {
+            throw std::runtime_error("Dimension of the matrix was not found");
+        }
+        if (instance_.metric)
+        {
+            throw std::runtime_error("Coordinates of the cities were not found");
+        }
+
+        throw std::runtime_error("Positions matrix was not found");
+    }
+
+    if (count_ != expected_)
+    {
+        if (instance_.metric)
+        {
+            throw std::runtime_error("Coordinates of some cities are missing");
+        }
+
+        throw std::runtime_error("Matrix from the given file has too few values");
+    }
+
+    stage_ = Stage::kFinished;
+    return std::move(instance_);
+}
+
+AtspParser::Format AtspParser::ParseFormat(std::string_view name)
+{
+    if (name == "FULL_MATRIX")
+    {
+        return Format::kFullMatrix;
+    }
+    if (name == "UPPER_ROW")
+    {
+        return Format::kUpperRow;
+    }
+    if (name == "LOWER_ROW")
+    {
+        return Format::kLowerRow;
+    }
+    if (name == "UPPER_DIAG_ROW")
+    {
+        return Format::kUpperDiagRow;
+    }
+    if (name == "LOWER_DIAG_ROW")
+    {
+        return Format::kLowerDiagRow;
+    }
+
+    throw std::runtime_error("Unsupported edge weight format " + std::string{ name });
+}
+
+void AtspParser::ProcessLine(std::string_view line)
+{
+    if (line == "EDGE_WEIGHT_SECTION")
+    {
+        PrepareWeights();
+        return;
+    }
+    if (line == "NODE_COORD_SECTION")
+    {
+        PrepareCoordinates();
+        return;
+    }
+
+    // The keys may be surrounded by any spaces
+    const auto separator = line.find(':');
+    if (separator == std::string_view::npos)
+    {
+        return;
+    }
+
+    const auto key = utils::Tokenizer::Trim(line.substr(0, separator));
+    const auto value = utils::Tokenizer::Trim(line.substr(separator + 1));
+    if (key == "DIMENSION")
+    {
+        dimension_ = utils::Tokenizer::Parse<uint32_t>(value);
+    }
+    else if (key == "EDGE_WEIGHT_FORMAT")
+    {
+        format_ = ParseFormat(value);
+    }
+    else if (key == "EDGE_WEIGHT_TYPE" && value != "EXPLICIT")
+    {
+        instance_.metric = tsp::ParseMetric(value);
+    }
+}
+
+void AtspParser::PrepareWeights()
+{
+    if (dimension_ == 0)
+    {
+        throw std::runtime_error("Dimension of the matrix was not found");
+    }
+    if (instance_.metric)
+    {
+        throw std::runtime_error("The weights are given explicitly, but the edge weight type is not EXPLICIT");
+    }
+
+    const size_t size = dimension_;
+    switch (format_)
+    {
+        case Format::kFullMatrix:
+            expected_ = size * size;
+            break;
+        case Format::kUpperRow:
+        case Format::kLowerRow:
+            expected_ = size * (size - 1) / 2;
+            break;
+        case Format::kUpperDiagRow:
+        case Format::kLowerDiagRow:
+            expected_ = size * (size + 1) / 2;
+            break;
+    }
+
+    instance_.weights.resize(dimension_, dimension_);
+    // The formats without the diagonal start at the first value next to it
+    row_ = format_ == Format::kLowerRow ? 1 : 0;
+    column_ = format_ == Format::kUpperRow ? 1 : 0;
+    stage_ = expected_ == 0 ? Stage::kFinished : Stage::kWeights;
+}
+
+void AtspParser::PrepareCoordinates()
+{
+    if (dimension_ == 0)
+    {
+        throw std::runtime_error("Dimension of the matrix was not found");
+    }
+    if (!instance_.metric)
+    {
+        throw std::runtime_error("The coordinates are given, but the edge weight type is EXPLICIT");
+    }
+
+    // Every city is given by its number and the two coordinates
+    expected_ = static_cast<size_t>(dimension_) * 3;
+    instance_.points.resize(dimension_);
+    stage_ = Stage::kCoordinates;
+}
+
+void AtspParser::ProcessToken(std::string_view token)
+{
+    if (std::isalpha(static_cast<unsigned char>(token.front())) != 0)
+    {
+        // A keyword ends the section, the rest of the file is not needed
+        stage_ = Stage::kFinished;
+        return;
+    }
+
+    if (count_ == expected_)
+    {
+        throw std::runtime_error(stage_ == Stage::kWeights ? "Matrix from the given file has too many values"
+                                                           : "The given file has more coordinates than cities");
+    }
+
+    if (stage_ == Stage::kWeights)
+    {
+        Put(utils::Tokenizer::Parse<uint32_t>(token));
+        return;
+    }
+
+    switch (count_++ % 3)
+    {
+        case 0:
+            row_ = utils::Tokenizer::Parse<uint32_t>(token);
+            if (row_ == 0 || row_ > dimension_)
+            {
+                throw std::runtime_error("City " + std::string{ token } + " is outside of the dimension");
+            }
+            break;
+        case 1:
+            instance_.points[row_ - 1].x = utils::Tokenizer::Parse<double>(token);
+            break;
+        default:
+            instance_.points[row_ - 1].y = utils::Tokenizer::Parse<double>(token);
+            break;
+    }
+}
+
+void AtspParser::Put(uint32_t value)
+{
+    instance_.weights(row_, column_) = value;
+    ++count_;
+
+    // Move to the next position of the row or to the first position of the next row
+    switch (format_)
+    {
+        case Format::kFullMatrix:
+            if (++column_ == dimension_)
+            {
+                column_ = 0;
+                ++row_;
+            }
+            break;
+        case Format::kUpperRow:
+        case Format::kUpperDiagRow:
+            instance_.weights(column_, row_) = value;
+            if (++column_ == dimension_)
+            {
+                ++row_;
+                column_ = format_ == Format::kUpperRow ? row_ + 1 : row_;
+            }
+            break;
+        case Format::kLowerRow:
+            instance_.weights(column_, row_) = value;
+            if (++column_ == row_)
+            {
+                ++row_;
+                column_ = 0;
+            }
+            break;
+        case Format::kLowerDiagRow:
+            instance_.weights(column_, row_) = value;
+            if (++column_ > row_)
+            {
+                ++row_;
+                column_ = 0;
+            }
+            break;
+    }
+}
+} // namespace io
@@ -0,0 +1,343 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "io/instancecache.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <initializer_list>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <variant>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define IO_MKSTEMP
+#include <cerrno>
+#include <cstdlib>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <functional>
+#include <thread>
+#endif
+
+#include "io/reader.hpp"
+#include "utils/hash.hpp"
+#include "utils/memory/alignedallocator.hpp"
+
+namespace
+{
+/**
+ * @brief Write the blocks to a new temporary file next to the path and move it over the path at once
+ *
+ * Other runs may read or write the same cache at the same time, so every writer gets a file of its own and the
+ * readers see either the old or the complete new file.
+ */
+void ReplaceFile(const std::filesystem::path& path, std::initializer_list<std::string_view> blocks)
+{
+#ifdef IO_MKSTEMP
+    std::string temporary = path.string() + ".XXXXXX";
+    const int descriptor = mkstemp(temporary.data());
+    if (descriptor < 0)
+    {
+        throw std::runtime_error("Cannot create a temporary file next to " + path.string());
+    }
+
+    // The cache is shared like the files created by the streams, instead of the private mode of mkstemp
+    bool written = fchmod(descriptor, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH) == 0;
+    for (auto block : blocks)
+    {
+        while (written && !block.empty())
+        {
+            const auto count = write(descriptor, block.data(), block.size());
+            if (count < 0 && errno == EINTR)
+            {
+                continue;
+            }
+
+            written = count > 0;
+            block.remove_prefix(written ? static_cast<size_t>(count) : 0);
+        }
+    }
+    written = close(descriptor) == 0 && written;
+#else
+    // Without mkstemp the name is unique only within this process
+    auto temporary = path;
+    temporary += ".tmp" + std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id()));
+    bool written{};
+    {
+        std::ofstream stream{ temporary, std::ios::binary | std::ios::trunc };
+        for (const auto block : blocks)
+        {
+            stream.write(block.data(), static_cast<std::streamsize>(block.size()));
+        }
+        written = static_cast<bool>(stream);
+    }
+#endif
+
+    std::error_code error;
+    if (written)
+    {
+        std::filesystem::rename(temporary, path, error);
+    }
+    if (!written || error)
+    {
+        std::filesystem::remove(temporary, error);
+        throw std::runtime_error("Cannot write " + path.string());
+    }
+}
+
+constexpr char kMagic[8]{ 'T', 'S', 'P', 'B', 'I', 'N', '0', '1' };
+
+struct Header
+{
+    char magic[8];
+    uint32_t dimension;
+
+    // The size of every stored value in bytes
+    uint32_t value_size;
+
+    // Non-zero when only the lower triangle of the matrix is stored
+    uint32_t symmetric;
+
+    // The value added to every stored one
+    uint32_t offset;
+
+    // The text file, from which the instance was converted
+    uint64_t source_size;
+    uint64_t source_hash;
+
+    // The hash of the block of the values
+    uint64_t checksum;
+
+    uint8_t reserved[16];
+};
+
+// The values start at a cache line of the page-aligned mapping
+static_assert(sizeof(Header) == utils::memory::kCacheLineSize);
+
+template <class T> size_t GetStorageSize(const math::Matrix<T>& matrix)
+{
+    return math::Matrix<T>::StorageSize(static_cast<uint32_t>(matrix.Columns()), static_cast<uint32_t>(matrix.Rows()));
+}
+
+template <class T> size_t GetStorageSize(const math::TriangularMatrix<T>& matrix)
+{
+    return math::TriangularMatrix<T>::StorageSize(static_cast<uint32_t>(matrix.Rows()));
+}
+
+template <class T>
+std::shared_ptr<const tsp::Distances> Map(const Header& header, std::shared_ptr<const utils::os::MappedFile> file)
+{
+    const auto size = header.dimension;
+    const size_t values = header.symmetric != 0 ? math::TriangularMatrix<T>::StorageSize(size)
+                                                : math::Matrix<T>::StorageSize(size, size);
+    if (file->size() != sizeof(Header) + values * sizeof(T))
+    {
+        throw std::runtime_error("The binary instance is truncated");
+    }
+    if (header.checksum != utils::Hash(file->data() + sizeof(Header), values * sizeof(T)))
+    {
+        throw std::runtime_error("The checksum of the binary instance does not match");
+    }
+
+    // The distances are shared read-only, so the values are never written through the mapping
+    auto* data = reinterpret_cast<T*>(const_cast<char*>(file->data() + sizeof(Header)));
+    if (header.symmetric != 0)
+    {
+        math::TriangularMatrix<T> matrix{ size, data, file };
+        return std::make_shared<const tsp::Distances>(tsp::SymmetricDistances<T>{ std::move(matrix), header.offset });
+    }
+
+    math::Matrix<T> matrix{ size, size, data, file };
+    return std::make_shared<const tsp::Distances>(tsp::DenseDistances<T>{ std::move(matrix), header.offset });
+}
+} // namespace
+
+namespace io
+{
+InstanceCache::InstanceCache(std::filesystem::path directory, uint32_t neighbours)
+    : directory_{ std::move(directory) }, neighbours_{ neighbours }
+{
+}
+
+std::shared_ptr<const tsp::Distances> InstanceCache::Load(const std::string& file)
+{
+    if (const auto iterator = loaded_.find(file); iterator != loaded_.end())
+    {
+        return iterator->second;
+    }
+
+    // The instance is remembered only once it was loaded, so a failed load is not mistaken for a loaded one later
+    auto result = Open(file);
+    loaded_.emplace(file, result);
+    return result;
+}
+
+std::shared_ptr<const tsp::Distances> InstanceCache::Open(const std::string& file) const
+{
+    auto source = std::make_shared<const utils::os::MappedFile>(file);
+    if (IsBinary(source->View()))
+    {
+        return Read(std::move(source));
+    }
+
+    const auto path = GetCachePath(file);
+    if (!path.empty() && std::filesystem::exists(path))
+    {
+        // The cached copy is used only when it was made from the same content and is not damaged
+        try
+        {
+            auto cached = std::make_shared<const utils::os::MappedFile>(path.string());
+            Header header;
+            if (IsBinary(cached->View()))
+            {
+                std::memcpy(&header, cached->data(), sizeof(header));
+                if (header.source_size == source->size() &&
+                    header.source_hash == utils::Hash(source->data(), source->size()))
+                {
+                    return Read(std::move(cached));
+                }
+            }
+        }
+        catch (const std::runtime_error& error)
+        {
+            std::cerr << "The cached copy of " << file << " is ignored: " << error.what() << std::endl;
+        }
+    }
+
+    if (path.empty())
+    {
+        // Without the cache the content is not hashed, so it is streamed instead of being read through the mapping
+        return MakeDistances(Reader<FileTypes::kAtsp>{ file }.Read());
+    }
+
+    auto result = MakeDistances(Reader<FileTypes::kAtsp>::Parse(source->View()));
+    if (std::holds_alternative<tsp::CoordinateDistances>(*result))
+    {
+        return result;
+    }
+
+    // The instance is still solved, when the cache cannot be written
+    try
+    {
+        std::filesystem::create_directories(directory_);
+        Write(path, *result, source->View());
+    }
+    catch (const std::exception& error)
+    {
+        std::cerr << "The instance " << file << " was not cached: " << error.what() << std::endl;
+    }
+
+    return result;
+}
+
+bool InstanceCache::IsBinary(std::string_view content) noexcept
+{
+    return content.size() >= sizeof(Header) && std::memcmp(content.data(), kMagic, sizeof(kMagic)) == 0;
+}
+
+std::shared_ptr<const tsp::Distances> InstanceCache::Read(std::shared_ptr<const utils::os::MappedFile> file)
+{
+    if (!IsBinary(file->View()))
+    {
+        throw std::runtime_error("The binary instance has no valid header");
+    }
+
+    Header header;
+    std::memcpy(&header, file->data(), sizeof(header));
+
+    switch (header.value_size)
+    {
+        case sizeof(uint8_t):
+            return Map<uint8_t>(header, std::move(file));
+        case sizeof(uint16_t):
+            return Map<uint16_t>(header, std::move(file));
+        case sizeof(uint32_t):
+            return Map<uint32_t>(header, std::move(file));
+    }
+
+    throw std::runtime_error("The binary instance has unsupported values");
+}
+
+void InstanceCache::Write(const std::filesystem::path& path, const tsp::Distances& distances, std::string_view source)
+{
+    std::visit(
+        [&path, source](const auto& representation) {
+            using Representation = std::decay_t<decltype(representation)>;
+            using T = typename Representation::value_type;
+            if constexpr (std::is_same_v<Representation, tsp::CoordinateDistances>)
+            {
+                throw std::runtime_error("The distances computed from the coordinates are not stored");
+            }
+            else
+            {
+                const auto& matrix = representation.GetMatrix();
+                const size_t bytes = GetStorageSize(matrix) * sizeof(T);
+
+                Header header{};
+                std::memcpy(header.magic, kMagic, sizeof(kMagic));
+                header.dimension = static_cast<uint32_t>(representation.Size());
+                header.value_size = sizeof(T);
+                header.symmetric = std::is_same_v<Representation, tsp::SymmetricDistances<T>> ? 1 : 0;
+                header.offset = representation.GetOffset();
+                header.source_size = source.size();
+                header.source_hash = utils::Hash(source.data(), source.size());
+                header.checksum = utils::Hash(matrix.data(), bytes);
+
+                ReplaceFile(path, { { reinterpret_cast<const char*>(&header), sizeof(header) },
+                                    { reinterpret_cast<const char*>(matrix.data()), bytes } });
+            }
+        },
+        distances);
+}
+
+std::shared_ptr<const tsp::Distances> InstanceCache::MakeDistances(
+    io::Reader<io::FileTypes::kAtsp>::Parameters parameters) const
+{
+    if (parameters.metric)
+    {
+        return std::make_shared<const tsp::Distances>(
+            tsp::CoordinateDistances{ std::move(parameters.points), *parameters.metric, neighbours_ });
+    }
+
+    return std::make_shared<const tsp::Distances>(tsp::Compact(parameters.positions));
+}
+
+std::filesystem::path InstanceCache::GetCachePath(const std::string& file) const
+{
+    if (directory_.empty())
+    {
+        return {};
+    }
+
+    // The hash of the absolute path separates the instances with the same name in different directories
+    const auto absolute = std::filesystem::absolute(file).lexically_normal().string();
+    std::ostringstream name;
+    name << std::filesystem::path{ file }.stem().string() << '-' << std::hex << std::setw(16) << std::setfill('0')
+         << utils::Hash(absolute.data(), absolute.size()) << ".bin";
+
+    return directory_ / name.str();
+}
+} // namespace io
@@ -0,0 +1,197 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "math/kdtree.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+namespace
+{
+double GetCoordinate(const math::Point& point, uint32_t depth) noexcept
+{
+    return depth % 2 == 0 ? point.x : point.y;
+}
+
+double GetSquaredDistance(const math::Point& first, const math::Point& second) noexcept
+{
+    const auto dx = first.x - second.x;
+    const auto dy = first.y - second.y;
+    return dx * dx + dy * dy;
+}
+} // namespace
+
+namespace math
+{
+KdTree::KdTree(std::span<const Point> points)
+    : points_{ points.begin(), points.end() }, order_(points.size()), positions_(points.size()),
+      remaining_(points.size()), removed_(points.size())
+{
+    std::iota(order_.begin(), order_.end(), 0);
+    Build(0, static_cast<uint32_t>(order_.size()), 0);
+
+    for (uint32_t position{}; position < order_.size(); ++position)
+    {
+        positions_[order_[position]] = position;
+    }
+}
+
+void KdTree::Nearest(const Point& query, uint32_t count, uint32_t skip, std::vector<uint32_t>& result) const
+{
+    Heap heap;
+    heap.reserve(count + 1);
+    if (count != 0)
+    {
+        Search(query, count, skip, 0, static_cast<uint32_t>(order_.size()), 0, heap);
+    }
+
+    std::sort_heap(heap.begin(), heap.end());
+    result.clear();
+    for (const auto& [distance, point] : heap)
+    {
+        result.push_back(point);
+    }
+}
+
+uint32_t KdTree::Nearest(const Point& query) const
+{
+    Heap heap;
+    Search(query, 1, static_cast<uint32_t>(Size()), 0, static_cast<uint32_t>(order_.size()), 0, heap);
+
+    return heap.empty() ? static_cast<uint32_t>(Size()) : heap.front().second;
+}
+
+void KdTree::Remove(uint32_t point)
+{
+    if (removed_[point])
+    {
+        return;
+    }
+    removed_[point] = true;
+
+    // Every range on the way from the root to the point loses one of the remaining points
+    const auto position = positions_[point];
+    uint32_t begin{}, end{ static_cast<uint32_t>(order_.size()) };
+    while (true)
+    {
+        const auto key = GetKey(begin, end);
+        --remaining_[key];
+        if (end - begin <= kLeafSize || position == key)
+        {
+            break;
+        }
+
+        if (position < key)
+        {
+            end = key;
+        }
+        else
+        {
+            begin = key + 1;
+        }
+    }
+}
+
+void KdTree::Build(uint32_t begin, uint32_t end, uint32_t depth)
+{
+    if (begin == end)
+    {
+        return;
+    }
+
+    remaining_[GetKey(begin, end)] = end - begin;
+    if (end - begin <= kLeafSize)
+    {
+        return;
+    }
+
+    const auto middle = GetKey(begin, end);
+    std::nth_element(order_.begin() + begin, order_.begin() + middle, order_.begin() + end,
+                     [this, depth](uint32_t first, uint32_t second) {
+                         return GetCoordinate(points_[first], depth) < GetCoordinate(points_[second], depth);
+                     });
+
+    Build(begin, middle, depth + 1);
+    Build(middle + 1, end, depth + 1);
+}
+
+void KdTree::Search(const Point& query, uint32_t count, uint32_t skip, uint32_t begin, uint32_t end,
+                    uint32_t depth, Heap& heap) const
+{
+    if (begin == end || remaining_[GetKey(begin, end)] == 0)
+    {
+        return;
+    }
+
+    const auto visit = [&](uint32_t point) {
+        if (point == skip || removed_[point])
+        {
+            return;
+        }
+
+        const auto distance = GetSquaredDistance(query, points_[point]);
+        if (heap.size() < count)
+        {
+            heap.emplace_back(distance, point);
+            std::push_heap(heap.begin(), heap.end());
+        }
+        else if (std::pair{ distance, point } < heap.front())
+        {
+            std::pop_heap(heap.begin(), heap.end());
+            heap.back() = { distance, point };
+            std::push_heap(heap.begin(), heap.end());
+        }
+    };
+
+    if (end - begin <= kLeafSize)
+    {
+        for (auto position = begin; position < end; ++position)
+        {
+            visit(order_[position]);
+        }
+        return;
+    }
+
+    // The side of the query is searched first, the other one only when it may hold a closer point
+    const auto middle = GetKey(begin, end);
+    const auto difference = GetCoordinate(query, depth) - GetCoordinate(points_[order_[middle]], depth);
+    const bool left = difference < 0;
+    if (left)
+    {
+        Search(query, count, skip, begin, middle, depth + 1, heap);
+    }
+    else
+    {
+        Search(query, count, skip, middle + 1, end, depth + 1, heap);
+    }
+
+    visit(order_[middle]);
+    if (heap.size() < count || difference * difference <= heap.front().first)
+    {
+        if (left)
+        {
+            Search(query, count, skip, middle + 1, end, depth + 1, heap);
+        }
+        else
+        {
+            Search(query, count, skip, begin, middle, depth + 1, heap);
+        }
+    }
+}
+} // namespace math
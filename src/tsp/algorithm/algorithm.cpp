@@ -19,19 +19,8 @@
 
 #include "tsp/algorithm/algorithm.hpp"
 
-#include <iostream>
-
 namespace tsp::algorithm
 {
-Algorithm::Algorithm(math::Matrix<uint32_t> distances) : distances_{ distances }
-{
-    if (distances_.Rows() != distances_.Columns())
-    {
-        std::cout << distances_.Rows() << " " << distances_.Columns() << std::endl;
-        throw std::runtime_error("The distances matrix has incorrect size");
-    }
-}
-
 bool Algorithm::Solution::operator<(const Solution& another)
 {
     return weight < another.weight;
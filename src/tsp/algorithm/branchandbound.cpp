@@ -0,0 +1,513 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+#include "tsp/algorithm/branchandbound.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <variant>
+
+#include "tsp/algorithm/heldkarp.hpp"
+
+namespace tsp::algorithm
+{
+namespace
+{
+constexpr size_t AlignTo(size_t offset, size_t alignment) noexcept
+{
+    return (offset + alignment - 1) / alignment * alignment;
+}
+
+// The heap keeps the smallest bound on top and prefers the deeper nodes, which are closer to a tour
+template <class Node> bool IsWorse(const Node* first, const Node* second) noexcept
+{
+    return first->bound != second->bound ? first->bound > second->bound : first->depth < second->depth;
+}
+} // namespace
+
+Order ParseOrder(const std::string& name)
+{
+    if (name == "best")
+    {
+        return Order::kBestFirst;
+    }
+    if (name == "depth")
+    {
+        return Order::kDepthFirst;
+    }
+
+    throw std::runtime_error("Unknown order of the nodes: " + name);
+}
+
+BranchAndBound::BranchAndBound(std::shared_ptr<const tsp::Distances> distances, const TS::Parameters& parameters,
+                               Order order)
+    : kCities{ static_cast<uint32_t>(std::visit([](const auto& value) { return value.Size(); }, *distances)) },
+      kOrder{ order }, distances_{ std::move(distances) }, parameters_{ parameters },
+      rows_offset_{ AlignTo(sizeof(Node), alignof(int64_t)) },
+      columns_offset_{ rows_offset_ + (kCities + 1) * sizeof(int64_t) },
+      assigned_offset_{ columns_offset_ + (kCities + 1) * sizeof(int64_t) },
+      successors_offset_{ assigned_offset_ + (kCities + 1) * sizeof(int32_t) },
+      predecessors_offset_{ successors_offset_ + kCities * sizeof(int16_t) },
+      excluded_offset_{ AlignTo(predecessors_offset_ + kCities * sizeof(int16_t), alignof(uint64_t)) },
+      excluded_words_{ (size_t{ kCities } * kCities + 63) / 64 },
+      pool_{ excluded_offset_ + excluded_words_ * sizeof(uint64_t) }
+{
+    if (kCities > kMaxCities)
+    {
+        throw std::runtime_error("The branch and bound supports at most " + std::to_string(kMaxCities) + " cities");
+    }
+
+    // The matrix is copied, so the costs of the relaxation are read without the dispatch on the representation
+    costs_.resize(size_t{ kCities } * kCities);
+    std::visit(
+        [this](const auto& value) {
+            for (uint32_t from{}; from < kCities; ++from)
+            {
+                for (uint32_t to{}; to < kCities; ++to)
+                {
+                    costs_[from * kCities + to] = from == to ? 0 : value(from, to);
+                }
+            }
+        },
+        *distances_);
+
+    max_nodes_ = kMaxMemory / pool_.GetBlockSize();
+    if (parameters_.threads != 1)
+    {
+        workers_ = std::make_unique<utils::WorkerGroup>(parameters_.threads);
+    }
+}
+
+Algorithm::Solution BranchAndBound::Solve()
+{
+    if (kCities <= 3)
+    {
+        // The relaxation of the tiny instances has no subtours to split, so they are left to the dynamic programming
+        return HeldKarp{ distances_ }.Solve();
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    end_ = start + parameters_.time_limit;
+
+    // The tabu search gives a good tour early, which prunes most of the nodes of the tree
+    auto search_parameters = parameters_;
+    search_parameters.time_limit = parameters_.time_limit / kSearchShare;
+    best_ = TS{ distances_, search_parameters }.Solve();
+    upper_bound_ = best_.weight;
+
+    // The root solves the whole assignment problem by adding the rows one by one
+    auto root = GetView(Allocate());
+    root.node->depth = 0;
+    std::fill_n(root.rows, kCities + 1, 0);
+    std::fill_n(root.columns, kCities + 1, 0);
+    std::fill_n(root.assigned, kCities + 1, 0);
+    std::fill_n(root.successors, kCities, -1);
+    std::fill_n(root.predecessors, kCities, -1);
+    std::fill_n(root.excluded, excluded_words_, 0);
+    for (uint32_t row{ 1 }; row <= kCities; ++row)
+    {
+        Augment(root, row);
+    }
+
+    root.node->bound = 0;
+    for (uint32_t column{ 1 }; column <= kCities; ++column)
+    {
+        root.node->bound += GetCost(root, root.assigned[column] - 1, column - 1);
+    }
+
+    std::vector<uint32_t> successors(kCities);
+    if (GetSuccessors(root, successors) == 1)
+    {
+        Offer(root, successors);
+        Release(root.node);
+    }
+    else
+    {
+        Push(root.node);
+    }
+
+    busy_ = 0;
+    stopped_ = false;
+    if (workers_ == nullptr)
+    {
+        Work();
+    }
+    else
+    {
+        workers_->Run([this](size_t) { Work(); });
+    }
+
+    // The open nodes cover all the tours, which could still be shorter than the best one
+    int64_t lower_bound = upper_bound_;
+    for (auto* node : open_)
+    {
+        lower_bound = std::min(lower_bound, node->bound);
+        Release(node);
+    }
+    open_.clear();
+
+    best_.bound = static_cast<uint32_t>(lower_bound);
+    return best_;
+}
+
+BranchAndBound::View BranchAndBound::GetView(void* block) const noexcept
+{
+    auto* bytes = static_cast<std::byte*>(block);
+    return { static_cast<Node*>(block),
+             reinterpret_cast<int64_t*>(bytes + rows_offset_),
+             reinterpret_cast<int64_t*>(bytes + columns_offset_),
+             reinterpret_cast<int32_t*>(bytes + assigned_offset_),
+             reinterpret_cast<int16_t*>(bytes + successors_offset_),
+             reinterpret_cast<int16_t*>(bytes + predecessors_offset_),
+             reinterpret_cast<uint64_t*>(bytes + excluded_offset_) };
+}
+
+void* BranchAndBound::Allocate()
+{
+    return pool_.Allocate();
+}
+
+void BranchAndBound::Release(Node* node) noexcept
+{
+    pool_.Deallocate(node);
+}
+
+int64_t BranchAndBound::GetCost(const View& view, uint32_t from, uint32_t to) const noexcept
+{
+    const size_t arc = size_t{ from } * kCities + to;
+    if (from == to || (view.excluded[arc / 64] >> (arc % 64) & 1) != 0)
+    {
+        return kInfinity;
+    }
+
+    // An arc forced into the tour forbids every other arc leaving its start or entering its end
+    const auto successor = view.successors[from];
+    const auto predecessor = view.predecessors[to];
+    if ((successor >= 0 && static_cast<uint32_t>(successor) != to) ||
+        (predecessor >= 0 && static_cast<uint32_t>(predecessor) != from))
+    {
+        return kInfinity;
+    }
+
+    return costs_[arc];
+}
+
+void BranchAndBound::Augment(const View& view, uint32_t row) const
+{
+    // The scratch of the Dijkstra-like search is reused by every augmentation of the thread
+    thread_local std::vector<int64_t> distances;
+    thread_local std::vector<uint32_t> previous;
+    thread_local std::vector<uint8_t> visited;
+    distances.assign(kCities + 1, std::numeric_limits<int64_t>::max());
+    previous.assign(kCities + 1, 0);
+    visited.assign(kCities + 1, 0);
+
+    // The column zero holds the free row, the path grows by the column of the smallest reduced cost until a free one
+    auto* assigned = view.assigned;
+    assigned[0] = static_cast<int32_t>(row);
+    uint32_t column{};
+    do
+    {
+        visited[column] = 1;
+        const auto current = static_cast<uint32_t>(assigned[column]);
+        int64_t delta = std::numeric_limits<int64_t>::max();
+        uint32_t next{};
+        for (uint32_t candidate{ 1 }; candidate <= kCities; ++candidate)
+        {
+            if (visited[candidate] != 0)
+            {
+                continue;
+            }
+
+            const int64_t reduced =
+                GetCost(view, current - 1, candidate - 1) - view.rows[current] - view.columns[candidate];
+            if (reduced < distances[candidate])
+            {
+                distances[candidate] = reduced;
+                previous[candidate] = column;
+            }
+            if (distances[candidate] < delta)
+            {
+                delta = distances[candidate];
+                next = candidate;
+            }
+        }
+
+        // The potentials move by the length of the step, so the reduced costs of the tree stay zero
+        for (uint32_t candidate{}; candidate <= kCities; ++candidate)
+        {
+            if (visited[candidate] != 0)
+            {
+                view.rows[assigned[candidate]] += delta;
+                view.columns[candidate] -= delta;
+            }
+            else
+            {
+                distances[candidate] -= delta;
+            }
+        }
+        column = next;
+    } while (assigned[column] != 0);
+
+    // Shift the rows along the path, which assigns the free row
+    do
+    {
+        const auto next = previous[column];
+        assigned[column] = assigned[next];
+        column = next;
+    } while (column != 0);
+}
+
+bool BranchAndBound::Exclude(const View& view, uint32_t from, uint32_t to) const noexcept
+{
+    const size_t arc = size_t{ from } * kCities + to;
+    view.excluded[arc / 64] |= uint64_t{ 1 } << (arc % 64);
+    if (view.assigned[to + 1] != static_cast<int32_t>(from + 1))
+    {
+        return false;
+    }
+
+    view.assigned[to + 1] = 0;
+    return true;
+}
+
+size_t BranchAndBound::GetSuccessors(const View& view, std::vector<uint32_t>& successors) const
+{
+    for (uint32_t column{ 1 }; column <= kCities; ++column)
+    {
+        successors[view.assigned[column] - 1] = column - 1;
+    }
+
+    std::vector<uint8_t> visited(kCities);
+    size_t cycles{};
+    for (uint32_t start{}; start < kCities; ++start)
+    {
+        if (visited[start] != 0)
+        {
+            continue;
+        }
+
+        ++cycles;
+        for (auto city = start; visited[city] == 0; city = successors[city])
+        {
+            visited[city] = 1;
+        }
+    }
+    return cycles;
+}
+
+void BranchAndBound::Branch(const View& view, std::vector<Node*>& children)
+{
+    std::vector<uint32_t> successors(kCities);
+    GetSuccessors(view, successors);
+
+    // The subtour with the fewest free arcs gives the fewest children
+    std::vector<uint8_t> visited(kCities);
+    std::vector<uint32_t> free;
+    std::vector<uint32_t> subtour;
+    size_t fewest = std::numeric_limits<size_t>::max();
+    for (uint32_t start{}; start < kCities; ++start)
+    {
+        if (visited[start] != 0)
+        {
+            continue;
+        }
+
+        subtour.clear();
+        for (auto city = start; visited[city] == 0; city = successors[city])
+        {
+            visited[city] = 1;
+            if (view.successors[city] < 0)
+            {
+                subtour.push_back(city);
+            }
+        }
+        if (subtour.size() < fewest)
+        {
+            fewest = subtour.size();
+            free.swap(subtour);
+        }
+    }
+
+    std::vector<uint32_t> rows;
+    std::vector<uint32_t> child_successors(kCities);
+    for (size_t split{}; split < free.size(); ++split)
+    {
+        auto child = GetView(Allocate());
+        std::memcpy(child.node, view.node, pool_.GetBlockSize());
+        ++child.node->depth;
+
+        // The arcs before the split are kept, so the children of the node share no tour
+        for (size_t kept{}; kept < split; ++kept)
+        {
+            child.successors[free[kept]] = static_cast<int16_t>(successors[free[kept]]);
+            child.predecessors[successors[free[kept]]] = static_cast<int16_t>(free[kept]);
+        }
+
+        rows.clear();
+        if (Exclude(child, free[split], successors[free[split]]))
+        {
+            rows.push_back(free[split] + 1);
+        }
+
+        // The arc closing a forced path into a subtour is forbidden as well, unless the path spans all the cities
+        for (size_t kept{}; kept < split; ++kept)
+        {
+            auto head = free[kept];
+            uint32_t arcs{};
+            while (child.predecessors[head] >= 0)
+            {
+                head = static_cast<uint32_t>(child.predecessors[head]);
+            }
+            auto tail = head;
+            while (child.successors[tail] >= 0)
+            {
+                tail = static_cast<uint32_t>(child.successors[tail]);
+                ++arcs;
+            }
+
+            if (arcs + 1 < kCities && Exclude(child, tail, head))
+            {
+                rows.push_back(tail + 1);
+            }
+        }
+
+        for (const auto row : rows)
+        {
+            Augment(child, row);
+        }
+
+        child.node->bound = 0;
+        for (uint32_t column{ 1 }; column <= kCities; ++column)
+        {
+            child.node->bound += GetCost(child, child.assigned[column] - 1, column - 1);
+        }
+
+        if (child.node->bound >= upper_bound_.load(std::memory_order_relaxed))
+        {
+            Release(child.node);
+        }
+        else if (GetSuccessors(child, child_successors) == 1)
+        {
+            Offer(child, child_successors);
+            Release(child.node);
+        }
+        else
+        {
+            children.push_back(child.node);
+        }
+    }
+}
+
+void BranchAndBound::Offer(const View& view, const std::vector<uint32_t>& successors)
+{
+    std::lock_guard lock{ best_mutex_ };
+    if (view.node->bound >= upper_bound_.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+
+    Tour::Cities path(kCities);
+    for (uint32_t position{ 1 }; position < kCities; ++position)
+    {
+        path[position] = successors[path[position - 1]];
+    }
+    best_.path = Tour{ std::move(path) };
+    best_.weight = static_cast<uint32_t>(view.node->bound);
+    upper_bound_.store(view.node->bound, std::memory_order_relaxed);
+}
+
+void BranchAndBound::Work()
+{
+    std::vector<Node*> children;
+    while (true)
+    {
+        Node* node{};
+        {
+            std::unique_lock lock{ mutex_ };
+            changed_.wait(lock, [this] { return stopped_ || !open_.empty() || busy_ == 0; });
+            if (stopped_ || open_.empty())
+            {
+                return;
+            }
+
+            node = Pop();
+            ++busy_;
+        }
+
+        // The node is kept when the search stops, so its bound still counts towards the proven one
+        const bool expired = std::chrono::steady_clock::now() >= end_ || pool_.GetUsed() >= max_nodes_ ||
+                             (parameters_.cancellation != nullptr && parameters_.cancellation->IsCancelled());
+        children.clear();
+        if (!expired && node->bound < upper_bound_.load(std::memory_order_relaxed))
+        {
+            Branch(GetView(node), children);
+        }
+
+        // The stack takes the children of the smallest bound last, so they are expanded first
+        if (kOrder == Order::kDepthFirst)
+        {
+            std::sort(children.begin(), children.end(),
+                      [](const Node* first, const Node* second) { return first->bound > second->bound; });
+        }
+
+        {
+            std::lock_guard lock{ mutex_ };
+            if (expired)
+            {
+                stopped_ = true;
+                Push(node);
+            }
+            else
+            {
+                Release(node);
+            }
+
+            for (auto* child : children)
+            {
+                Push(child);
+            }
+            --busy_;
+        }
+        changed_.notify_all();
+    }
+}
+
+void BranchAndBound::Push(Node* node)
+{
+    open_.push_back(node);
+    if (kOrder == Order::kBestFirst)
+    {
+        std::push_heap(open_.begin(), open_.end(), IsWorse<Node>);
+    }
+}
+
+BranchAndBound::Node* BranchAndBound::Pop()
+{
+    if (kOrder == Order::kBestFirst)
+    {
+        std::pop_heap(open_.begin(), open_.end(), IsWorse<Node>);
+    }
+
+    auto* node = open_.back();
+    open_.pop_back();
+    return node;
+}
+} // namespace tsp::algorithm
@@ -0,0 +1,52 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "tsp/algorithm/elitepool.hpp"
+
+namespace tsp::algorithm
+{
+ElitePool::ElitePool(size_t capacity) : elite_{ capacity }, threshold_{ elite_.GetThreshold() }
+{
+}
+
+void ElitePool::Publish(const Algorithm::Solution& solution)
+{
+    if (solution.weight >= threshold_.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+
+    std::lock_guard lock{ mutex_ };
+    if (elite_.Offer(solution))
+    {
+        threshold_.store(elite_.GetThreshold(), std::memory_order_relaxed);
+    }
+}
+
+std::optional<Algorithm::Solution> ElitePool::Sample(utils::Random& random) const
+{
+    std::lock_guard lock{ mutex_ };
+    if (elite_.empty())
+    {
+        return std::nullopt;
+    }
+
+    return elite_[random.Bounded(static_cast<uint32_t>(elite_.size()))];
+}
+} // namespace tsp::algorithm
@@ -0,0 +1,81 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "tsp/algorithm/eliteset.hpp"
+
+#include <algorithm>
+
+namespace
+{
+/**
+ * @brief Check whether both tours visit the cities in the same order, possibly starting from a different city
+ */
+bool IsSameCycle(const tsp::Tour& first, const tsp::Tour& second)
+{
+    if (first.size() != second.size())
+    {
+        return false;
+    }
+
+    const size_t size = first.size();
+    const size_t shift = size == 0 ? 0 : second.Position(first[0]);
+    for (size_t position{}; position < size; ++position)
+    {
+        if (first[position] != second[(shift + position) % size])
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+} // namespace
+
+namespace tsp::algorithm
+{
+EliteSet::EliteSet(size_t capacity) : kCapacity{ capacity }
+{
+    solutions_.reserve(capacity);
+}
+
+bool EliteSet::Offer(const Algorithm::Solution& solution)
+{
+    if (kCapacity == 0 || solution.weight >= GetThreshold())
+    {
+        return false;
+    }
+
+    const auto is_same = [&solution](const auto& another) {
+        return another.weight == solution.weight && IsSameCycle(another.path, solution.path);
+    };
+    if (std::any_of(solutions_.begin(), solutions_.end(), is_same))
+    {
+        return false;
+    }
+
+    const auto is_lighter = [](uint32_t weight, const auto& another) { return weight < another.weight; };
+    solutions_.insert(std::upper_bound(solutions_.begin(), solutions_.end(), solution.weight, is_lighter), solution);
+    if (solutions_.size() > kCapacity)
+    {
+        solutions_.pop_back();
+    }
+
+    return true;
+}
+} // namespace tsp::algorithm
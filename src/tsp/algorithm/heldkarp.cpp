@@ -0,0 +1,211 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "tsp/algorithm/heldkarp.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <variant>
+
+#include "tsp/kernels.hpp"
+
+namespace tsp::algorithm
+{
+namespace
+{
+/**
+ * @brief Get the next larger subset with the same amount of elements (Gosper's hack)
+ */
+constexpr size_t GetNextSubset(size_t subset) noexcept
+{
+    const size_t lowest = subset & (~subset + 1);
+    const size_t ripple = subset + lowest;
+    return (((ripple ^ subset) >> 2) / lowest) | ripple;
+}
+} // namespace
+
+HeldKarp::HeldKarp(std::shared_ptr<const tsp::Distances> distances, size_t threads)
+    : kCities{ static_cast<uint32_t>(std::visit([](const auto& value) { return value.Size(); }, *distances)) }
+{
+    if (kCities > kMaxCities)
+    {
+        throw std::runtime_error("The exact solver supports at most " + std::to_string(kMaxCities) + " cities");
+    }
+
+    // The small matrix is copied, so the table is filled without the dispatch on the representation
+    distances_.resize(kCities * kCities);
+    std::visit(
+        [this](const auto& value) {
+            for (uint32_t from{}; from < kCities; ++from)
+            {
+                for (uint32_t to{}; to < kCities; ++to)
+                {
+                    distances_[from * kCities + to] = from == to ? 0 : value(from, to);
+                }
+            }
+        },
+        *distances);
+
+    if (threads != 1)
+    {
+        workers_ = std::make_unique<utils::WorkerGroup>(threads);
+    }
+}
+
+Algorithm::Solution HeldKarp::Solve()
+{
+    if (kCities <= 3)
+    {
+        // Every order of up to three cities gives the same cycle, up to the direction
+        Solution solution;
+        Tour::Cities cities(kCities);
+        std::iota(cities.begin(), cities.end(), 0);
+        solution.path = Tour{ std::move(cities) };
+        for (uint32_t position{}; position < kCities; ++position)
+        {
+            solution.weight += GetDistance(position, (position + 1) % kCities);
+        }
+
+        if (kCities == 3)
+        {
+            const uint32_t reversed = GetDistance(0, 2) + GetDistance(2, 1) + GetDistance(1, 0);
+            if (reversed < solution.weight)
+            {
+                solution.path = Tour{ { 0, 2, 1 } };
+                solution.weight = reversed;
+            }
+        }
+        solution.bound = solution.weight;
+        return solution;
+    }
+
+    // Any sum of a path and an edge, including the unreachable states, fits twice the longest tour
+    const uint64_t longest = uint64_t{ *std::max_element(distances_.begin(), distances_.end()) } * kCities;
+    if (longest < std::numeric_limits<uint16_t>::max() / 2)
+    {
+        return Solve<uint16_t>();
+    }
+    if (longest < std::numeric_limits<uint32_t>::max() / 2)
+    {
+        return Solve<uint32_t>();
+    }
+
+    throw std::runtime_error("The weights are too large for the exact solver");
+}
+
+template <class T> Algorithm::Solution HeldKarp::Solve()
+{
+    // The first city starts the tour, the others are the bits of the subsets
+    const uint32_t cities = kCities - 1;
+    const size_t subsets = size_t{ 1 } << cities;
+    constexpr T kInfinity{ std::numeric_limits<T>::max() / 2 };
+
+    // The distances into every city are contiguous, like the paths ending at every city of a subset
+    std::vector<T> into(static_cast<size_t>(cities) * cities);
+    for (uint32_t last{}; last < cities; ++last)
+    {
+        for (uint32_t previous{}; previous < cities; ++previous)
+        {
+            into[last * cities + previous] = last == previous ? kInfinity : GetDistance(previous + 1, last + 1);
+        }
+    }
+
+    // The paths ending outside of their subsets stay infinite, so the minimum may run over all the predecessors
+    std::vector<T> table(subsets * cities, kInfinity);
+    for (uint32_t last{}; last < cities; ++last)
+    {
+        table[(size_t{ 1 } << last) * cities + last] = static_cast<T>(GetDistance(0, last + 1));
+    }
+
+    const auto min_plus = kernels::GetMinPlus<T>();
+    for (int size{ 2 }; size <= static_cast<int>(cities); ++size)
+    {
+        // The subsets of the same size depend only on the smaller ones, so the chunks of a layer are independent
+        const auto layer = [&, size](size_t worker, size_t step) {
+            size_t index{};
+            for (size_t subset{ (size_t{ 1 } << size) - 1 }; subset < subsets; subset = GetNextSubset(subset), ++index)
+            {
+                if (index / kChunkSize % step != worker)
+                {
+                    continue;
+                }
+
+                for (auto rest = subset; rest != 0; rest &= rest - 1)
+                {
+                    const auto last = static_cast<uint32_t>(std::countr_zero(rest));
+                    const auto* paths = &table[(subset ^ (size_t{ 1 } << last)) * cities];
+                    table[subset * cities + last] = min_plus(paths, &into[last * cities], cities);
+                }
+            }
+        };
+
+        if (workers_ == nullptr)
+        {
+            layer(0, 1);
+        }
+        else
+        {
+            workers_->Run([&layer, this](size_t worker) { layer(worker, workers_->Size()); });
+        }
+    }
+
+    // Close the cycle at the first city
+    const size_t all = subsets - 1;
+    Solution solution;
+    solution.weight = std::numeric_limits<uint32_t>::max();
+    uint32_t last{};
+    for (uint32_t city{}; city < cities; ++city)
+    {
+        const uint32_t weight = table[all * cities + city] + GetDistance(city + 1, 0);
+        if (weight < solution.weight)
+        {
+            solution.weight = weight;
+            last = city;
+        }
+    }
+
+    // Walk back through the predecessors, which give the stored weights
+    Tour::Cities path(kCities);
+    size_t subset = all;
+    for (uint32_t position{ cities }; position > 0; --position)
+    {
+        path[position] = last + 1;
+        const auto previous = subset ^ (size_t{ 1 } << last);
+        const auto weight = table[subset * cities + last];
+        for (auto rest = previous; rest != 0; rest &= rest - 1)
+        {
+            const auto city = static_cast<uint32_t>(std::countr_zero(rest));
+            if (table[previous * cities + city] + into[last * cities + city] == weight)
+            {
+                last = city;
+                break;
+            }
+        }
+        subset = previous;
+    }
+
+    solution.path = Tour{ std::move(path) };
+    solution.bound = solution.weight;
+    return solution;
+}
+} // namespace tsp::algorithm
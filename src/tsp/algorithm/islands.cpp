@@ -0,0 +1,121 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "tsp/algorithm/islands.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <future>
+#include <utility>
+#include <vector>
+
+#include "tsp/algorithm/elitepool.hpp"
+#include "utils/random.hpp"
+
+namespace tsp::algorithm
+{
+Islands::Islands(std::shared_ptr<const tsp::Distances> distances, const TS::Parameters& parameters)
+    : distances_{ std::move(distances) }, parameters_{ parameters }, count_{ parameters.islands }
+{
+    parameters_.islands = 1;
+
+    // The islands already occupy the threads, so every island evaluates its neighbourhoods on its own thread only
+    parameters_.threads = 1;
+    parameters_.pool = std::make_shared<ElitePool>(std::max<size_t>(parameters.elite, 1));
+
+    if (parameters.scheduler != nullptr)
+    {
+        count_ = count_ == 0 ? parameters.scheduler->Size() : count_;
+        return;
+    }
+
+    workers_ = std::make_unique<utils::WorkerGroup>(count_);
+    count_ = workers_->Size();
+}
+
+Algorithm::Solution Islands::Solve()
+{
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<std::optional<Solution>> solutions(count_);
+    if (workers_ != nullptr)
+    {
+        workers_->Run([this, &solutions, start](size_t island) { solutions[island] = SolveIsland(island, start); });
+    }
+    else
+    {
+        // The first island runs on the current worker, the others wait in its queue for the idle workers
+        auto* scheduler = parameters_.scheduler;
+        std::vector<std::future<std::optional<Solution>>> futures;
+        for (size_t island{ 1 }; island < count_; ++island)
+        {
+            futures.push_back(scheduler->Submit([this, island, start]() { return SolveIsland(island, start); }));
+        }
+
+        // The islands refer to this object, so all of them are awaited before an error is passed on
+        std::exception_ptr error;
+        try
+        {
+            solutions[0] = SolveIsland(0, start);
+        }
+        catch (...)
+        {
+            error = std::current_exception();
+        }
+        for (size_t island{ 1 }; island < count_; ++island)
+        {
+            try
+            {
+                solutions[island] = scheduler->Join(std::move(futures[island - 1]));
+            }
+            catch (...)
+            {
+                error = error == nullptr ? std::current_exception() : error;
+            }
+        }
+        if (error != nullptr)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+
+    // The first island always runs, so there is at least one solution
+    const auto is_lighter = [](const auto& first, const auto& second) {
+        return first.has_value() && (!second.has_value() || first->weight < second->weight);
+    };
+    return std::move(**std::min_element(solutions.begin(), solutions.end(), is_lighter));
+}
+
+std::optional<Algorithm::Solution> Islands::SolveIsland(size_t island,
+                                                        std::chrono::steady_clock::time_point start) const
+{
+    auto parameters = parameters_;
+    parameters.seed = utils::Random::Derive(parameters_.seed, island);
+
+    // An island started late by the scheduler gets only the rest of the time limit
+    const auto elapsed =
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    if (island != 0 && elapsed >= parameters.time_limit)
+    {
+        return std::nullopt;
+    }
+    parameters.time_limit -= std::min(elapsed, parameters.time_limit);
+
+    return TS{ distances_, parameters }.Solve();
+}
+} // namespace tsp::algorithm
@@ -0,0 +1,236 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "tsp/algorithm/longtermmemory.hpp"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+
+#include "tsp/distances.hpp"
+
+namespace tsp::algorithm
+{
+Restart ParseRestart(const std::string& name)
+{
+    if (name == "random")
+    {
+        return Restart::kRandom;
+    }
+    if (name == "frequency")
+    {
+        return Restart::kFrequency;
+    }
+    if (name == "elite")
+    {
+        return Restart::kElite;
+    }
+
+    throw std::runtime_error("Unknown restart strategy " + name);
+}
+
+LongTermMemory::LongTermMemory(uint32_t cities, size_t elite)
+    : kCities{ cities }, kSampleInterval{ std::max(cities / kEdgesPerIteration, 1U) }, elite_{ elite }
+{
+    if (cities <= kMaxDenseCities)
+    {
+        frequencies_.resize(cities, cities);
+    }
+}
+
+void LongTermMemory::Visit(const Tour& tour)
+{
+    if (++iteration_ < kSampleInterval)
+    {
+        return;
+    }
+
+    iteration_ = 0;
+    ++samples_;
+    for (size_t position{}; position < tour.size(); ++position)
+    {
+        const auto first = tour[position];
+        const auto second = tour[(position + 1) % tour.size()];
+        if (IsSparse())
+        {
+            ++sparse_frequencies_[GetKey(first, second)];
+            continue;
+        }
+
+        ++frequencies_(first, second);
+        ++frequencies_(second, first);
+    }
+}
+
+void LongTermMemory::Offer(const Algorithm::Solution& solution)
+{
+    elite_.Offer(solution);
+}
+
+template <class Distances>
+Tour LongTermMemory::Diversify(const Distances& distances, const CandidateList* candidates, utils::Random& random) const
+{
+    const auto size = static_cast<uint32_t>(distances.Size());
+    const auto cost = [this, &distances](uint32_t from, uint32_t to) {
+        const double frequency = samples_ == 0 ? 0.0 : static_cast<double>(GetFrequency(from, to)) / samples_;
+        return distances(from, to) * (1.0 + kPenalty * frequency);
+    };
+
+    // The unvisited cities are kept together with the index of every city among them, size marks a visited one
+    std::vector<uint32_t> unvisited(size);
+    std::vector<uint32_t> indices(size);
+    std::iota(unvisited.begin(), unvisited.end(), 0);
+    std::iota(indices.begin(), indices.end(), 0);
+    const auto visit = [&unvisited, &indices, size](uint32_t city) {
+        const auto last = unvisited.back();
+        unvisited[indices[city]] = last;
+        indices[last] = indices[city];
+        indices[city] = size;
+        unvisited.pop_back();
+    };
+
+    Tour::Cities cities;
+    cities.reserve(size);
+    if (size == 0)
+    {
+        return Tour{ std::move(cities) };
+    }
+
+    cities.push_back(random.Bounded(size));
+    visit(cities.back());
+    while (!unvisited.empty())
+    {
+        const auto last = cities.back();
+        auto next = size;
+        auto best = std::numeric_limits<double>::max();
+        const auto consider = [&](uint32_t city) {
+            const auto value = cost(last, city);
+            if (value < best || (value == best && city < next))
+            {
+                next = city;
+                best = value;
+            }
+        };
+
+        // The nearest neighbours are tried first, all the unvisited cities only when every neighbour is visited
+        if (candidates != nullptr)
+        {
+            for (const auto city : candidates->Successors(last))
+            {
+                if (indices[city] != size)
+                {
+                    consider(city);
+                }
+            }
+        }
+        if (next == size)
+        {
+            std::for_each(unvisited.begin(), unvisited.end(), consider);
+        }
+
+        cities.push_back(next);
+        visit(next);
+    }
+
+    return Tour{ std::move(cities) };
+}
+
+template <class Distances>
+std::optional<Algorithm::Solution> LongTermMemory::Relink(const Distances& distances, utils::Random& random) const
+{
+    const auto count = static_cast<uint32_t>(elite_.size());
+    if (count < 2 || kCities < 4)
+    {
+        return std::nullopt;
+    }
+
+    const auto initial = random.Bounded(count);
+    auto guiding = random.Bounded(count - 1);
+    guiding += guiding >= initial ? 1 : 0;
+
+    const Tour& guide = elite_[guiding].path;
+    const size_t size = guide.size();
+    Tour current = elite_[initial].path;
+
+    // The guide is read from the first city of the current tour, as both tours are cycles
+    const size_t shift = guide.Position(current[0]);
+    const auto target = [&guide, shift, size](size_t position) { return guide[(shift + position) % size]; };
+
+    // The weight of the edges leaving the positions around the swapped ones, each edge counted once
+    const auto weight_around = [&distances, &current, size](size_t i, size_t j) {
+        std::array<size_t, 4> positions{ (i + size - 1) % size, i, (j + size - 1) % size, j };
+        std::sort(positions.begin(), positions.end());
+        const auto end = std::unique(positions.begin(), positions.end());
+
+        int64_t result{};
+        for (auto position = positions.begin(); position != end; ++position)
+        {
+            result += distances(current[*position], current[(*position + 1) % size]);
+        }
+        return result;
+    };
+
+    // Every swap puts one more city of the guide in its place, the weights after every swap are remembered
+    std::vector<int64_t> weights;
+    int64_t weight = elite_[initial].weight;
+    for (size_t position{ 1 }; position < size; ++position)
+    {
+        if (current[position] == target(position))
+        {
+            continue;
+        }
+
+        const auto other = current.Position(target(position));
+        const auto before = weight_around(position, other);
+        current.Swap(position, other);
+        weight += weight_around(position, other) - before;
+        weights.push_back(weight);
+    }
+
+    // The last swap reaches the guide, so only the solutions strictly between the elite ones are considered
+    if (weights.size() < 2)
+    {
+        return std::nullopt;
+    }
+
+    const auto steps = std::distance(weights.begin(), std::min_element(weights.begin(), weights.end() - 1)) + 1;
+
+    // The chosen solution is rebuilt instead of copying the tour at every improvement, the heuristic proves no bound
+    Algorithm::Solution result{ elite_[initial].path, static_cast<uint32_t>(weights[steps - 1]), std::nullopt };
+    for (size_t position{ 1 }, swaps{}; swaps < static_cast<size_t>(steps); ++position)
+    {
+        if (result.path[position] != target(position))
+        {
+            result.path.Swap(position, result.path.Position(target(position)));
+            ++swaps;
+        }
+    }
+
+    return result;
+}
+
+#define TSP_INSTANTIATE(Distances)                                                                                     \
+    template Tour LongTermMemory::Diversify<Distances>(const Distances&, const CandidateList*, utils::Random&) const; \
+    template std::optional<Algorithm::Solution> LongTermMemory::Relink<Distances>(const Distances&, utils::Random&)    \
+        const;
+TSP_FOR_EACH_DISTANCES(TSP_INSTANTIATE)
+#undef TSP_INSTANTIATE
+} // namespace tsp::algorithm
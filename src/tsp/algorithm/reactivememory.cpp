@@ -0,0 +1,83 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "tsp/algorithm/reactivememory.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace tsp::algorithm
+{
+ReactiveMemory::ReactiveMemory(uint32_t cities, uint32_t tenure)
+    : kCities{ cities }, kMaxTenure{ std::max(cities, 1U) }, tenure_{ std::clamp(tenure, 1U, kMaxTenure) }
+{
+}
+
+bool ReactiveMemory::Visit(uint64_t hash)
+{
+    ++iteration_;
+    if (visited_.size() >= kMaxVisited)
+    {
+        visited_.clear();
+    }
+
+    const auto [visit, inserted] = visited_.try_emplace(hash, Entry{ iteration_, 0 });
+    if (inserted)
+    {
+        // Without returns the tenure is larger than needed
+        if (iteration_ - last_change_ > average_cycle_)
+        {
+            tenure_ = std::max(static_cast<uint32_t>(tenure_ * kDecrease), 1U);
+            last_change_ = iteration_;
+        }
+        return false;
+    }
+
+    const auto length = iteration_ - visit->second.iteration;
+    visit->second.iteration = iteration_;
+    if (++visit->second.repetitions > kRepetitions && ++chaotic_ > kChaotic)
+    {
+        chaotic_ = 0;
+        visited_.clear();
+        return true;
+    }
+
+    // A short cycle means that the tenure does not prevent returning to the same solutions
+    if (length < 2 * kCities)
+    {
+        average_cycle_ = 0.1 * length + 0.9 * average_cycle_;
+        tenure_ = std::min(std::max(static_cast<uint32_t>(std::ceil(tenure_ * kIncrease)), tenure_ + 1), kMaxTenure);
+        last_change_ = iteration_;
+    }
+
+    return false;
+}
+
+void ReactiveMemory::Clear()
+{
+    visited_.clear();
+    chaotic_ = 0;
+    last_change_ = iteration_;
+}
+
+uint32_t ReactiveMemory::GetEscapeLength() const noexcept
+{
+    return std::min(1 + static_cast<uint32_t>(average_cycle_ / 2), std::max(kCities / 2, 1U));
+}
+} // namespace tsp::algorithm
@@ -0,0 +1,73 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "tsp/algorithm/tabumemory.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace tsp::algorithm
+{
+TabuMemory::TabuMemory(uint32_t cities, uint32_t tenure) : tenure_{ tenure }
+{
+    if (cities <= kMaxDenseCities)
+    {
+        expirations_.resize(cities, cities);
+    }
+}
+
+void TabuMemory::Advance()
+{
+    // Start over before the expiration iterations could overflow
+    if (iteration_ >= std::numeric_limits<uint32_t>::max() - tenure_)
+    {
+        Reset();
+        return;
+    }
+
+    ++iteration_;
+
+    // The sparse memory keeps at most the pairs forbidden during the last tenure
+    if (IsSparse() && tenure_ != 0 && iteration_ % tenure_ == 0)
+    {
+        std::erase_if(sparse_expirations_, [this](const auto& entry) { return entry.second <= iteration_; });
+    }
+}
+
+void TabuMemory::Clear()
+{
+    if (horizon_ >= std::numeric_limits<uint32_t>::max() - tenure_)
+    {
+        Reset();
+        return;
+    }
+
+    // Every stored expiration is at most the horizon, so none of them forbids a move after it
+    iteration_ = horizon_;
+    sparse_expirations_.clear();
+}
+
+void TabuMemory::Reset()
+{
+    std::fill_n(expirations_.data(), expirations_.Rows() * expirations_.Columns(), 0);
+    sparse_expirations_.clear();
+    iteration_ = 1;
+    horizon_ = 1;
+}
+} // namespace tsp::algorithm
@@ -0,0 +1,329 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "tsp/algorithm/tabusearch.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+#include "tsp/kernels.hpp"
+#include "utils/deadline.hpp"
+
+namespace tsp::algorithm
+{
+template <class Distances>
+TabuSearch<Distances>::TabuSearch(std::shared_ptr<const Distances> distances, const TS::Parameters& parameters)
+    : shared_distances_{ std::move(distances) }, distances_{ *shared_distances_ },
+      kIterationsPerEpoch{ parameters.max_iterations }, kTimeLimit{ parameters.time_limit },
+      kMaxOvershoot{ parameters.max_overshoot }, cancellation_{ parameters.cancellation },
+      kRestart{ parameters.restart }, pool_{ parameters.pool }, kExchangeInterval{ parameters.exchange_interval },
+      random_{ parameters.seed }
+{
+    if (parameters.neighbourhoods.empty())
+    {
+        throw std::runtime_error("At least one neighbourhood should be used");
+    }
+
+    for (const auto type : parameters.neighbourhoods)
+    {
+        auto& neighbourhood = neighbourhoods_.emplace_back(
+            neighbourhood::Create<Distances>(type, distances_, static_cast<uint32_t>(parameters.max_tabu)));
+        neighbourhood->SetCandidates(parameters.candidates);
+        neighbourhood->SetDontLookBits(parameters.dont_look_bits);
+    }
+
+    candidate_list_ = parameters.candidates;
+    construction_.type = parameters.construction;
+    construction_.roots = parameters.construction_roots;
+    construction_.candidates = candidate_list_.get();
+
+    if (kRestart != Restart::kRandom)
+    {
+        memory_.emplace(static_cast<uint32_t>(distances_.Size()), parameters.elite);
+    }
+
+    if (parameters.reactive)
+    {
+        const auto cities = static_cast<uint32_t>(distances_.Size());
+        hasher_.emplace(cities, utils::Random::Derive(parameters.seed, 1));
+        reactive_.emplace(cities, static_cast<uint32_t>(parameters.max_tabu));
+    }
+
+    if (parameters.threads != 1)
+    {
+        workers_ = std::make_unique<utils::WorkerGroup>(parameters.threads);
+    }
+    candidates_.resize((workers_ == nullptr ? 1 : workers_->Size()) * neighbourhoods_.size());
+}
+
+template <class Distances> Algorithm::Solution TabuSearch<Distances>::Solve()
+{
+    solution_.path = CalculateStartingPath();
+    solution_.weight = CalculateWeight(solution_);
+
+    // The clock is read only every few iterations, as an iteration may take just a few microseconds
+    utils::Deadline deadline{ kTimeLimit, kMaxOvershoot, cancellation_ };
+    uint32_t iteration{};
+    uint32_t exchange{};
+    Solution current_solution = solution_;
+    Solution epoch_best = solution_;
+    if (hasher_)
+    {
+        hash_ = (*hasher_)(current_solution.path);
+    }
+
+    while (!deadline.IsExpired())
+    {
+        if (iteration > kIterationsPerEpoch)
+        {
+            current_solution = CalculateRestart(epoch_best);
+            epoch_best = current_solution;
+            for (auto& neighbourhood : neighbourhoods_)
+            {
+                neighbourhood->Clear();
+            }
+            if (reactive_)
+            {
+                hash_ = (*hasher_)(current_solution.path);
+                reactive_->Clear();
+            }
+
+            iteration = 0;
+        }
+
+        iteration++;
+        current_solution = CalculateNeighbour(current_solution);
+        if (reactive_)
+        {
+            React(current_solution);
+        }
+        if (memory_)
+        {
+            memory_->Visit(current_solution.path);
+        }
+        if ((memory_ || pool_) && current_solution < epoch_best)
+        {
+            epoch_best = current_solution;
+        }
+
+        if (current_solution < solution_)
+        {
+            solution_ = current_solution;
+
+            // Clear the iteration counter
+            iteration = 0;
+        }
+
+        // The other islands get the best solution of this one with a delay, which bounds the cost of the exchange
+        if (pool_ && ++exchange >= kExchangeInterval)
+        {
+            pool_->Publish(solution_);
+            exchange = 0;
+        }
+    }
+
+    return solution_;
+}
+
+template <class Distances> Algorithm::Path TabuSearch<Distances>::CalculateStartingPath()
+{
+    return construction::Construct(distances_, construction_, random_);
+}
+
+template <class Distances> Algorithm::Path TabuSearch<Distances>::CalculateRandomPath()
+{
+    return construction::Construct(distances_, { construction::Type::kRandom }, random_);
+}
+
+template <class Distances> Algorithm::Solution TabuSearch<Distances>::CalculateRestart(const Solution& epoch_best)
+{
+    // The informed restarts alternate, so the elite keeps getting solutions from other regions
+    const bool alternate = restarts_++ % 2 == 0;
+
+    // The elite of the other islands is recombined by the relinking or adopted directly
+    std::optional<Solution> adopted;
+    if (pool_)
+    {
+        pool_->Publish(epoch_best);
+        adopted = pool_->Sample(random_);
+    }
+    if (memory_)
+    {
+        memory_->Offer(epoch_best);
+        if (adopted)
+        {
+            memory_->Offer(*adopted);
+        }
+    }
+
+    if (alternate && kRestart == Restart::kElite)
+    {
+        if (auto relinked = memory_->Relink(distances_, random_))
+        {
+#ifdef TSP_VERIFY_MOVES
+            if (relinked->weight != CalculateWeight(*relinked))
+            {
+                throw std::logic_error("The weight of the relinked solution does not match the recalculated one");
+            }
+#endif
+            return std::move(*relinked);
+        }
+    }
+    if (alternate && adopted)
+    {
+        return std::move(*adopted);
+    }
+
+    Solution result;
+    result.path = memory_ ? memory_->Diversify(distances_, candidate_list_.get(), random_) : CalculateRandomPath();
+    result.weight = CalculateWeight(result);
+    return result;
+}
+
+template <class Distances> Algorithm::Solution TabuSearch<Distances>::CalculateNeighbour(Solution solution)
+{
+    const size_t count = neighbourhoods_.size();
+    for (auto& neighbourhood : neighbourhoods_)
+    {
+        neighbourhood->Prepare(solution.path);
+    }
+
+    // A forbidden move is still allowed when it leads to a solution better than the best known one
+    const int64_t aspiration = static_cast<int64_t>(solution_.weight) - solution.weight;
+
+    const auto scan = [this, &solution, aspiration, count](size_t worker, size_t step) {
+        for (size_t index{}; index < count; ++index)
+        {
+            candidates_[worker * count + index] =
+                neighbourhoods_[index]->Scan(solution.path, aspiration, worker + 1, step);
+        }
+    };
+
+    if (workers_ == nullptr)
+    {
+        scan(0, 1);
+    }
+    else
+    {
+        // The rows are interleaved between the workers, as the rows get shorter with the position
+        const size_t step = workers_->Size();
+        workers_->Run([&scan, step](size_t worker) { scan(worker, step); });
+
+        // Merge the results with the same tie-break as the sequential scan
+        for (size_t worker{ 1 }; worker < step; ++worker)
+        {
+            for (size_t index{}; index < count; ++index)
+            {
+                candidates_[index].Merge(candidates_[worker * count + index]);
+            }
+        }
+    }
+
+    // The earlier neighbourhood wins a tie
+    const auto select = [this, count](neighbourhood::Move neighbourhood::Candidates::*member) {
+        std::pair<size_t, neighbourhood::Move> result{ count, {} };
+        for (size_t index{}; index < count; ++index)
+        {
+            if ((candidates_[index].*member).delta < result.second.delta)
+            {
+                result = { index, candidates_[index].*member };
+            }
+        }
+        return result;
+    };
+
+    auto [chosen, move] = select(&neighbourhood::Candidates::best);
+    if (chosen == count)
+    {
+        // Every move is forbidden, so the best of them is taken to keep the search going
+        std::tie(chosen, move) = select(&neighbourhood::Candidates::fallback);
+    }
+
+    if (chosen == count)
+    {
+        // All the rows may be skipped by the don't look bits, so the next iteration scans everything
+        for (auto& neighbourhood : neighbourhoods_)
+        {
+            neighbourhood->ResetDontLookBits();
+        }
+        return solution;
+    }
+
+    // The hash is updated by the edges around the changed cities, before and after the move
+    const auto changed = neighbourhoods_[chosen]->GetChangedCities(solution.path, move);
+    if (hasher_)
+    {
+        hash_ ^= hasher_->Incident(solution.path, changed);
+    }
+    neighbourhoods_[chosen]->Apply(solution.path, move);
+    if (hasher_)
+    {
+        hash_ ^= hasher_->Incident(solution.path, changed);
+#ifdef TSP_VERIFY_MOVES
+        if (hash_ != (*hasher_)(solution.path))
+        {
+            throw std::logic_error("The updated hash does not match the hash of the whole tour");
+        }
+#endif
+    }
+    for (auto& neighbourhood : neighbourhoods_)
+    {
+        neighbourhood->Advance();
+    }
+
+    solution.weight = static_cast<uint32_t>(solution.weight + move.delta);
+
+    return solution;
+}
+
+template <class Distances> void TabuSearch<Distances>::React(Solution& solution)
+{
+    const auto size = static_cast<uint32_t>(solution.path.size());
+    if (reactive_->Visit(hash_) && size > 2)
+    {
+        // The first city is never moved, like in the neighbourhoods
+        for (auto steps = reactive_->GetEscapeLength(); steps > 0; --steps)
+        {
+            solution.path.Swap(1 + random_.Bounded(size - 1), 1 + random_.Bounded(size - 1));
+        }
+        solution.weight = CalculateWeight(solution);
+        hash_ = (*hasher_)(solution.path);
+
+        for (auto& neighbourhood : neighbourhoods_)
+        {
+            neighbourhood->ResetDontLookBits();
+        }
+    }
+
+    for (auto& neighbourhood : neighbourhoods_)
+    {
+        neighbourhood->SetTenure(reactive_->GetTenure());
+    }
+}
+
+template <class Distances> uint32_t TabuSearch<Distances>::CalculateWeight(const Solution& solution) const
+{
+    return static_cast<uint32_t>(kernels::TourLength(distances_, solution.path.data(), solution.path.size()));
+}
+#define TSP_INSTANTIATE(Distances) template class TabuSearch<Distances>;
+TSP_FOR_EACH_DISTANCES(TSP_INSTANTIATE)
+} // namespace tsp::algorithm
\ No newline at end of file
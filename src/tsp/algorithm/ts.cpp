@@ -19,181 +19,41 @@
 
 #include "tsp/algorithm/ts.hpp"
 
-#include <algorithm>
-#include <cmath>
-#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <variant>
 
-namespace tsp::algorithm
-{
-TS::TS(math::Matrix<uint32_t> distances, size_t max_tabu, uint32_t max_iterations, std::chrono::milliseconds time_limit)
-    : Algorithm{ distances }, kMaxTabuSize{ max_tabu }, kIterationsPerEpoch{ max_iterations }, kTimeLimit{ time_limit }
-{
-}
-
-Algorithm::Solution TS::Solve()
-{
-    solution_.path = CalculateStartingPath();
-    solution_.weight = CalculateWeight(solution_);
-
-    const auto start_timestamp = std::chrono::high_resolution_clock::now();
-    uint32_t iteration{};
-    Solution current_solution = solution_;
-    while ((std::chrono::high_resolution_clock::now() - start_timestamp) < kTimeLimit)
-    {
-        if (iteration > kIterationsPerEpoch)
-        {
-            current_solution.path = CalculateRandomPath();
-            current_solution.weight = CalculateWeight(current_solution);
-
-            iteration = 0;
-        }
-
-        iteration++;
-        current_solution = CalculateNeighbour(current_solution);
-
-        if (current_solution < solution_)
-        {
-            solution_ = current_solution;
-
-            // Clear the iteration counter
-            iteration = 0;
-        }
-    }
+#include "tsp/algorithm/islands.hpp"
+#include "tsp/algorithm/tabusearch.hpp"
 
-    return solution_;
-}
-
-Algorithm::Path TS::CalculateStartingPath()
-{
-    Path firstpath;
-    std::vector<bool> visited;
-    visited.resize(distances_.Columns());
-
-    int minchoice, minnode, lastnode;
-
-    firstpath.push_back(0);
-    visited.at(0) = true;
-
-    for (int i = 1; i < distances_.Columns(); i++)
-    {
-        minchoice = std::numeric_limits<int>::max();
-        minnode = 0;
-        lastnode = firstpath.back();
-
-        for (int j = 0; j < distances_.Columns(); j++)
-        {
-            if (!visited.at(j) && distances_(lastnode, j) < minchoice)
-            {
-                minchoice = distances_(lastnode, j);
-                minnode = j;
-            }
-        }
-        firstpath.push_back(minnode);
-        visited.at(minnode) = true;
-    }
-    return firstpath;
-}
-
-Algorithm::Path TS::CalculateRandomPath()
-{
-    Path randpath;
-    std::vector<bool> visited;
-    visited.resize(distances_.Columns());
-    int x = 0;
-    randpath.push_back(0);
-
-    for (int i = 0; i < distances_.Columns() - 1; i++)
-    {
-        x = rand() % (distances_.Columns() - 1) + 1;
-        if (visited[x] != true)
-        {
-            randpath.push_back(x);
-            visited[x] = true;
-        }
-        else
-        {
-            i--;
-        }
-    }
-    return randpath;
-}
-
-std::vector<TS::Tabu> TS::CalculateTabus(Solution solution) const
+namespace tsp::algorithm
 {
-    std::vector<Tabu> result;
-    result.push_back({ 0, 0 });
-
-    for (int i = 1; i < distances_.Columns() - 1; i++)
-    {
-        for (int j = i; j < distances_.Columns() - 1; j++)
-        {
-            result.push_back({ solution.path.at(i), solution.path.at(j) });
-        }
-    }
-
-    return result;
-}
-
-TS::Solution TS::CalculateNeighbour(Solution solution)
+TS::TS(std::shared_ptr<const tsp::Distances> distances, const Parameters& parameters)
 {
-    Solution result = { solution.path, std::numeric_limits<uint32_t>::max() };
-    Tabu new_tabu;
-
-    for (const auto& tabu : CalculateTabus(solution))
+    if (parameters.islands != 1)
     {
-        Swap(solution, tabu.first, tabu.last);
-
-        if (CalculateWeight(solution) < result.weight)
-        {
-            auto iterator = std::find(tabus_.begin(), tabus_.end(), tabu);
-            if (iterator != tabus_.end())
-            {
-                tabus_.erase(iterator);
-            }
-
-            result = { solution.path, CalculateWeight(solution) };
-            new_tabu = { tabu.last, tabu.first };
-        }
-
-        Swap(solution, tabu.last, tabu.first);
+        search_ = std::make_unique<Islands>(std::move(distances), parameters);
+        return;
     }
 
-    AddTabu(new_tabu);
+    const auto create = [&distances, &parameters](const auto& representation) -> std::unique_ptr<Algorithm> {
+        using Representation = std::decay_t<decltype(representation)>;
 
-    return result;
+        // The search shares the ownership of the whole variant
+        std::shared_ptr<const Representation> shared{ distances, &representation };
+        return std::make_unique<TabuSearch<Representation>>(std::move(shared), parameters);
+    };
+    search_ = std::visit(create, *distances);
 }
 
-void TS::AddTabu(const Tabu& value)
-{
-    tabus_.push_back(value);
-    if (tabus_.size() > kMaxTabuSize)
-    {
-        tabus_.erase(tabus_.begin());
-    }
-}
-
-uint32_t TS::CalculateWeight(const Solution& solution)
+Algorithm::Solution TS::Solve()
 {
-    uint32_t result{};
-    for (int i = 0; i < distances_.Columns() - 1; i++)
+    // The starting tours begin at random cities, so the same cycle is always written from the first city
+    auto solution = search_->Solve();
+    if (!solution.path.empty())
     {
-        result += distances_(solution.path.at(i), solution.path.at(i + 1));
+        solution.path.Rotate(0);
     }
-    result += distances_(solution.path.at(distances_.Columns() - 1), solution.path.at(0));
-    return result;
-}
-
-void TS::Swap(Solution& solution, uint32_t i, uint32_t j)
-{
-    int x = std::distance(solution.path.begin(), std::find(solution.path.begin(), solution.path.end(), i));
-    int y = std::distance(solution.path.begin(), std::find(solution.path.begin(), solution.path.end(), j));
-
-    solution.path.at(x) = j;
-    solution.path.at(y) = i;
-}
-
-bool TS::Tabu::operator==(const Tabu& another) const
-{
-    return first == another.first && last == another.last;
+    return solution;
 }
-} // namespace tsp::algorithm
\ No newline at end of file
+} // namespace tsp::algorithm
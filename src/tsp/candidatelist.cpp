@@ -0,0 +1,92 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "tsp/candidatelist.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <variant>
+
+namespace
+{
+/**
+ * @brief Write the given amount of the cities with the smallest distances, skipping the city itself
+ */
+template <class Distance>
+void SelectNearest(uint32_t city, uint32_t cities, uint32_t size, std::vector<uint32_t>& buffer, Distance distance,
+                   uint32_t* output)
+{
+    buffer.resize(cities);
+    std::iota(buffer.begin(), buffer.end(), 0);
+    std::swap(buffer[city], buffer.back());
+    buffer.pop_back();
+
+    const auto compare = [&distance](uint32_t first, uint32_t second) {
+        const auto first_distance = distance(first);
+        const auto second_distance = distance(second);
+        return first_distance != second_distance ? first_distance < second_distance : first < second;
+    };
+    std::partial_sort(buffer.begin(), buffer.begin() + size, buffer.end(), compare);
+    std::copy_n(buffer.begin(), size, output);
+}
+} // namespace
+
+namespace tsp
+{
+CandidateList::CandidateList(const Distances& representation, uint32_t size)
+{
+    std::visit([this, size](const auto& distances) { Build(distances, size); }, representation);
+}
+
+template <class Representation> void CandidateList::Build(const Representation& distances, uint32_t size)
+{
+    const auto cities = static_cast<uint32_t>(distances.Size());
+    size_ = cities == 0 ? 0 : std::min(size, cities - 1);
+    successors_.resize(static_cast<size_t>(cities) * size_);
+    predecessors_.resize(static_cast<size_t>(cities) * size_);
+
+    std::vector<uint32_t> buffer;
+    for (uint32_t city{}; city < cities; ++city)
+    {
+        const auto offset = static_cast<size_t>(city) * size_;
+        SelectNearest(
+            city, cities, size_, buffer, [&distances, city](uint32_t other) { return distances(city, other); },
+            successors_.data() + offset);
+        SelectNearest(
+            city, cities, size_, buffer, [&distances, city](uint32_t other) { return distances(other, city); },
+            predecessors_.data() + offset);
+    }
+}
+
+void CandidateList::Build(const CoordinateDistances& distances, uint32_t size)
+{
+    const auto cities = static_cast<uint32_t>(distances.Size());
+    size_ = cities == 0 ? 0 : std::min(size, cities - 1);
+    successors_.resize(static_cast<size_t>(cities) * size_);
+
+    // The distances are symmetric, so the nearest cities are both the successors and the predecessors
+    std::vector<uint32_t> nearest;
+    for (uint32_t city{}; city < cities; ++city)
+    {
+        distances.FindNearest(city, size_, nearest);
+        std::copy(nearest.begin(), nearest.end(), successors_.data() + static_cast<size_t>(city) * size_);
+    }
+    predecessors_ = successors_;
+}
+} // namespace tsp
@@ -0,0 +1,445 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "tsp/construction.hpp"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+constexpr uint32_t kNone{ std::numeric_limits<uint32_t>::max() };
+
+// The amount of the nearest neighbours of every city, whose edges are sorted by the greedy edge without candidates
+constexpr uint32_t kGreedyNeighbours{ 10 };
+
+// The side of the grid, on which the Hilbert curve orders the cities
+constexpr uint32_t kCurveSide{ 1U << 16 };
+
+// Only the full matrices hold asymmetric instances, as the symmetric ones are always stored as a triangle
+template <class Distances> struct IsDense : std::false_type
+{
+};
+
+template <class T> struct IsDense<tsp::DenseDistances<T>> : std::true_type
+{
+};
+
+template <class Distances> uint64_t GetLength(const Distances& distances, const tsp::Tour::Cities& cities)
+{
+    uint64_t length{};
+    for (size_t position{}; position < cities.size(); ++position)
+    {
+        length += distances(cities[position], cities[(position + 1) % cities.size()]);
+    }
+
+    return length;
+}
+
+template <class Distances> tsp::Tour::Cities NearestNeighbour(const Distances& distances, uint32_t root)
+{
+    const auto size = static_cast<uint32_t>(distances.Size());
+    tsp::Tour::Cities cities;
+    cities.reserve(size);
+    cities.push_back(root);
+
+    // The nearest unvisited city is found by the spatial index, when the cities are given on a plane
+    if constexpr (std::is_same_v<Distances, tsp::CoordinateDistances>)
+    {
+        if (const auto* index = distances.GetIndex(); index != nullptr)
+        {
+            auto unvisited = *index;
+            unvisited.Remove(root);
+            while (cities.size() < size)
+            {
+                const auto nearest = unvisited.Nearest(distances.GetPoints()[cities.back()]);
+                cities.push_back(nearest);
+                unvisited.Remove(nearest);
+            }
+
+            return cities;
+        }
+    }
+
+    // The unvisited cities are kept together, so every step scans only them
+    std::vector<uint32_t> unvisited(size);
+    std::iota(unvisited.begin(), unvisited.end(), 0);
+    std::swap(unvisited[root], unvisited.back());
+    unvisited.pop_back();
+
+    while (!unvisited.empty())
+    {
+        const auto last = cities.back();
+        size_t nearest{};
+        for (size_t index{ 1 }; index < unvisited.size(); ++index)
+        {
+            const auto distance = distances(last, unvisited[index]);
+            const auto best = distances(last, unvisited[nearest]);
+            if (distance < best || (distance == best && unvisited[index] < unvisited[nearest]))
+            {
+                nearest = index;
+            }
+        }
+
+        cities.push_back(unvisited[nearest]);
+        unvisited[nearest] = unvisited.back();
+        unvisited.pop_back();
+    }
+
+    return cities;
+}
+
+template <class Distances>
+tsp::Tour::Cities MultiRootNearestNeighbour(const Distances& distances, uint32_t roots, utils::Random& random)
+{
+    const auto size = static_cast<uint32_t>(distances.Size());
+    auto best = NearestNeighbour(distances, 0);
+    auto best_length = GetLength(distances, best);
+
+    // The first root is always the first city, so a single root gives the same tour in every run
+    for (uint32_t root{ 1 }; root < std::min(roots, size); ++root)
+    {
+        auto cities = NearestNeighbour(distances, random.Bounded(size));
+        const auto length = GetLength(distances, cities);
+        if (length < best_length)
+        {
+            best = std::move(cities);
+            best_length = length;
+        }
+    }
+
+    return best;
+}
+
+/**
+ * @brief Find the nearest cities, to which the edges from the given one lead
+ */
+template <class Distances>
+void FindNearest(const Distances& distances, uint32_t city, uint32_t count, std::vector<uint32_t>& result)
+{
+    if constexpr (std::is_same_v<Distances, tsp::CoordinateDistances>)
+    {
+        distances.FindNearest(city, count, result);
+    }
+    else
+    {
+        const auto size = static_cast<uint32_t>(distances.Size());
+        result.resize(size);
+        std::iota(result.begin(), result.end(), 0);
+        std::swap(result[city], result.back());
+        result.pop_back();
+
+        count = std::min(count, static_cast<uint32_t>(result.size()));
+        std::partial_sort(result.begin(), result.begin() + count, result.end(), [&](uint32_t first, uint32_t second) {
+            return std::pair{ distances(city, first), first } < std::pair{ distances(city, second), second };
+        });
+        result.resize(count);
+    }
+}
+
+uint32_t FindRoot(std::vector<uint32_t>& parents, uint32_t city)
+{
+    while (parents[city] != city)
+    {
+        parents[city] = parents[parents[city]];
+        city = parents[city];
+    }
+
+    return city;
+}
+
+template <class Distances>
+tsp::Tour::Cities GreedyEdge(const Distances& distances, const tsp::CandidateList* candidates)
+{
+    constexpr bool kSymmetric = !IsDense<Distances>::value;
+    const auto size = static_cast<uint32_t>(distances.Size());
+
+    // Only the edges to the nearest neighbours are considered, the rest of the tour is joined afterwards
+    std::vector<std::tuple<uint32_t, uint32_t, uint32_t>> edges;
+    std::vector<uint32_t> nearest;
+    for (uint32_t city{}; city < size; ++city)
+    {
+        if (candidates != nullptr)
+        {
+            const auto successors = candidates->Successors(city);
+            nearest.assign(successors.begin(), successors.end());
+        }
+        else
+        {
+            FindNearest(distances, city, kGreedyNeighbours, nearest);
+        }
+
+        for (const auto other : nearest)
+        {
+            edges.emplace_back(distances(city, other), city, other);
+        }
+    }
+    std::sort(edges.begin(), edges.end());
+
+    // Every city has the predecessor and the successor, the symmetric tours use them as two unordered links
+    std::vector<std::array<uint32_t, 2>> links(size, { kNone, kNone });
+    std::vector<uint32_t> parents(size);
+    std::iota(parents.begin(), parents.end(), 0);
+    const auto is_free = [&links](uint32_t city, size_t side) {
+        return kSymmetric ? links[city][1] == kNone : links[city][side] == kNone;
+    };
+    const auto link = [&links](uint32_t city, size_t side, uint32_t other) {
+        if constexpr (kSymmetric)
+        {
+            links[city][links[city][0] == kNone ? 0 : 1] = other;
+        }
+        else
+        {
+            links[city][side] = other;
+        }
+    };
+
+    uint32_t accepted{};
+    for (const auto& [distance, from, to] : edges)
+    {
+        if (accepted + 1 >= size)
+        {
+            break;
+        }
+
+        // The edge should not close a cycle, nor give a city a third neighbour
+        if (!is_free(from, 1) || !is_free(to, 0) || FindRoot(parents, from) == FindRoot(parents, to))
+        {
+            continue;
+        }
+
+        parents[FindRoot(parents, from)] = FindRoot(parents, to);
+        link(from, 1, to);
+        link(to, 0, from);
+        ++accepted;
+    }
+
+    // Walk every fragment from its first city, the fragments are kept one after another
+    std::vector<uint32_t> order;
+    std::vector<std::pair<uint32_t, uint32_t>> fragments;
+    std::vector<bool> visited(size);
+    order.reserve(size);
+    for (uint32_t city{}; city < size; ++city)
+    {
+        const bool first = kSymmetric ? links[city][1] == kNone : links[city][0] == kNone;
+        if (visited[city] || !first)
+        {
+            continue;
+        }
+
+        const auto begin = static_cast<uint32_t>(order.size());
+        uint32_t previous{ kNone }, current{ city };
+        while (current != kNone)
+        {
+            visited[current] = true;
+            order.push_back(current);
+
+            auto next = links[current][1];
+            if constexpr (kSymmetric)
+            {
+                next = links[current][0] == previous ? links[current][1] : links[current][0];
+            }
+            previous = current;
+            current = next;
+        }
+        fragments.emplace_back(begin, static_cast<uint32_t>(order.size()));
+    }
+
+    // Join the fragments, each time with the one starting (or ending for the symmetric instances) closest to the tail
+    tsp::Tour::Cities cities;
+    cities.reserve(size);
+    std::vector<bool> used(fragments.size());
+    for (size_t joined{}; joined < fragments.size(); ++joined)
+    {
+        size_t best{};
+        bool reversed{};
+        uint32_t best_distance{ std::numeric_limits<uint32_t>::max() };
+        for (size_t index{}; index < fragments.size(); ++index)
+        {
+            if (used[index])
+            {
+                continue;
+            }
+            if (cities.empty())
+            {
+                best = index;
+                break;
+            }
+
+            const auto [begin, end] = fragments[index];
+            if (const auto distance = distances(cities.back(), order[begin]); distance < best_distance)
+            {
+                best = index;
+                reversed = false;
+                best_distance = distance;
+            }
+            if constexpr (kSymmetric)
+            {
+                if (const auto distance = distances(cities.back(), order[end - 1]); distance < best_distance)
+                {
+                    best = index;
+                    reversed = true;
+                    best_distance = distance;
+                }
+            }
+        }
+
+        used[best] = true;
+        const auto [begin, end] = fragments[best];
+        if (reversed)
+        {
+            cities.insert(cities.end(), order.rbegin() + (order.size() - end), order.rbegin() + (order.size() - begin));
+        }
+        else
+        {
+            cities.insert(cities.end(), order.begin() + begin, order.begin() + end);
+        }
+    }
+
+    return cities;
+}
+
+/**
+ * @brief Get the distance of the point of the grid from the beginning of the Hilbert curve
+ */
+uint64_t GetHilbertIndex(uint32_t x, uint32_t y)
+{
+    uint64_t index{};
+    for (uint32_t side{ kCurveSide / 2 }; side > 0; side /= 2)
+    {
+        const uint32_t rx = (x & side) != 0 ? 1 : 0;
+        const uint32_t ry = (y & side) != 0 ? 1 : 0;
+        index += static_cast<uint64_t>(side) * side * ((3 * rx) ^ ry);
+
+        // Rotate the quadrant, so the curve continues in it
+        if (ry == 0)
+        {
+            if (rx == 1)
+            {
+                x = kCurveSide - 1 - x;
+                y = kCurveSide - 1 - y;
+            }
+            std::swap(x, y);
+        }
+    }
+
+    return index;
+}
+
+tsp::Tour::Cities SpaceFillingCurve(const std::vector<math::Point>& points)
+{
+    if (points.empty())
+    {
+        return {};
+    }
+
+    // The bounding box of the cities is stretched over the grid
+    const auto by_x = [](const auto& first, const auto& second) { return first.x < second.x; };
+    const auto by_y = [](const auto& first, const auto& second) { return first.y < second.y; };
+    const auto [min_x, max_x] = std::minmax_element(points.begin(), points.end(), by_x);
+    const auto [min_y, max_y] = std::minmax_element(points.begin(), points.end(), by_y);
+    const auto scale = (kCurveSide - 1) / std::max({ max_x->x - min_x->x, max_y->y - min_y->y, 1e-9 });
+
+    std::vector<std::pair<uint64_t, uint32_t>> keys(points.size());
+    for (uint32_t city{}; city < points.size(); ++city)
+    {
+        const auto x = static_cast<uint32_t>((points[city].x - min_x->x) * scale);
+        const auto y = static_cast<uint32_t>((points[city].y - min_y->y) * scale);
+        keys[city] = { GetHilbertIndex(x, y), city };
+    }
+    std::sort(keys.begin(), keys.end());
+
+    tsp::Tour::Cities cities(points.size());
+    std::transform(keys.begin(), keys.end(), cities.begin(), [](const auto& key) { return key.second; });
+    return cities;
+}
+
+tsp::Tour::Cities Random(uint32_t size, utils::Random& random)
+{
+    tsp::Tour::Cities cities(size);
+    std::iota(cities.begin(), cities.end(), 0);
+
+    // Fisher-Yates shuffle
+    for (uint32_t index{ size }; index > 1; --index)
+    {
+        std::swap(cities[index - 1], cities[random.Bounded(index)]);
+    }
+
+    return cities;
+}
+} // namespace
+
+namespace tsp::construction
+{
+Type ParseType(const std::string& name)
+{
+    if (name == "nearest")
+    {
+        return Type::kNearestNeighbour;
+    }
+    if (name == "greedy")
+    {
+        return Type::kGreedyEdge;
+    }
+    if (name == "curve")
+    {
+        return Type::kSpaceFillingCurve;
+    }
+    if (name == "random")
+    {
+        return Type::kRandom;
+    }
+
+    throw std::runtime_error("Unknown construction heuristic " + name);
+}
+
+template <class Distances>
+Tour Construct(const Distances& distances, const Parameters& parameters, utils::Random& random)
+{
+    const auto size = static_cast<uint32_t>(distances.Size());
+    switch (parameters.type)
+    {
+        case Type::kNearestNeighbour:
+            return Tour{ MultiRootNearestNeighbour(distances, parameters.roots, random) };
+        case Type::kGreedyEdge:
+            return Tour{ GreedyEdge(distances, parameters.candidates) };
+        case Type::kSpaceFillingCurve:
+            if constexpr (std::is_same_v<Distances, CoordinateDistances>)
+            {
+                return Tour{ SpaceFillingCurve(distances.GetPoints()) };
+            }
+            throw std::runtime_error("The space-filling curve needs the coordinates of the cities");
+        case Type::kRandom:
+            return Tour{ Random(size, random) };
+    }
+
+    throw std::runtime_error("Unknown construction heuristic");
+}
+
+#define TSP_INSTANTIATE(Distances)                                                                                     \
+    template Tour Construct<Distances>(const Distances&, const Parameters&, utils::Random&);
+TSP_FOR_EACH_DISTANCES(TSP_INSTANTIATE)
+#undef TSP_INSTANTIATE
+} // namespace tsp::construction
@@ -0,0 +1,255 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "tsp/distances.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace
+{
+// The constants of the geographic distance given by the TSPLIB
+constexpr double kPi{ 3.141592 };
+constexpr double kEarthRadius{ 6378.388 };
+
+/**
+ * @brief Convert the coordinate given as DDD.MM (degrees and minutes) into radians
+ */
+double ToRadians(double value)
+{
+    const auto degrees = std::trunc(value);
+    return kPi * (degrees + 5.0 * (value - degrees) / 3.0) / 180.0;
+}
+
+uint32_t Round(double value)
+{
+    return static_cast<uint32_t>(value + 0.5);
+}
+/**
+ * @brief Copy the offsets of the distances off the diagonal into the given matrix
+ */
+template <class T, class Matrix> Matrix Narrow(const math::Matrix<uint32_t>& matrix, uint32_t offset, Matrix result)
+{
+    const auto size = static_cast<uint32_t>(matrix.Rows());
+    for (uint32_t row{}; row < size; ++row)
+    {
+        for (uint32_t column{}; column < size; ++column)
+        {
+            if (row != column)
+            {
+                result(row, column) = static_cast<T>(matrix(row, column) - offset);
+            }
+        }
+    }
+
+    return result;
+}
+
+template <class T> tsp::Distances Build(const math::Matrix<uint32_t>& matrix, uint32_t offset, bool symmetric)
+{
+    const auto size = static_cast<uint32_t>(matrix.Rows());
+    if (symmetric)
+    {
+        return tsp::SymmetricDistances<T>{ Narrow<T>(matrix, offset, math::TriangularMatrix<T>{ size }), offset };
+    }
+
+    return tsp::DenseDistances<T>{ Narrow<T>(matrix, offset, math::Matrix<T>{ size, size }), offset };
+}
+} // namespace
+
+namespace tsp
+{
+Distances Compact(const math::Matrix<uint32_t>& matrix)
+{
+    if (matrix.Rows() != matrix.Columns())
+    {
+        throw std::runtime_error("The distances matrix has incorrect size");
+    }
+
+    // The diagonal often holds a placeholder, which would widen the range for nothing
+    const auto size = static_cast<uint32_t>(matrix.Rows());
+    uint32_t minimum{ std::numeric_limits<uint32_t>::max() }, maximum{};
+    bool symmetric{ true };
+    for (uint32_t row{}; row < size; ++row)
+    {
+        for (uint32_t column{}; column < size; ++column)
+        {
+            if (row == column)
+            {
+                continue;
+            }
+
+            minimum = std::min(minimum, matrix(row, column));
+            maximum = std::max(maximum, matrix(row, column));
+            symmetric = symmetric && matrix(row, column) == matrix(column, row);
+        }
+    }
+
+    const uint32_t offset = minimum > maximum ? 0 : minimum;
+    const uint32_t range = maximum - offset;
+    if (range <= std::numeric_limits<uint8_t>::max())
+    {
+        return Build<uint8_t>(matrix, offset, symmetric);
+    }
+    if (range <= std::numeric_limits<uint16_t>::max())
+    {
+        return Build<uint16_t>(matrix, offset, symmetric);
+    }
+
+    return Build<uint32_t>(matrix, offset, symmetric);
+}
+
+CoordinateDistances::CoordinateDistances(std::vector<math::Point> points, Metric metric, uint32_t cached)
+    : points_{ std::move(points) }, metric_{ metric }
+{
+    const auto cities = static_cast<uint32_t>(points_.size());
+    if (metric_ == Metric::kGeographic)
+    {
+        radians_.reserve(cities);
+        for (const auto& point : points_)
+        {
+            radians_.push_back({ ToRadians(point.x), ToRadians(point.y) });
+        }
+    }
+    else
+    {
+        // The planar distances grow with the Euclidean one, so the nearest cities are found by their coordinates
+        index_.emplace(points_);
+    }
+
+    cached_ = cities == 0 ? 0 : std::min(cached, cities - 1);
+    if (cached_ == 0)
+    {
+        return;
+    }
+
+    neighbours_.resize(static_cast<size_t>(cities) * cached_);
+    cache_.resize(neighbours_.size());
+
+    std::vector<uint32_t> nearest;
+    for (uint32_t city{}; city < cities; ++city)
+    {
+        FindNearest(city, cached_, nearest);
+        std::sort(nearest.begin(), nearest.begin() + cached_);
+
+        const auto offset = static_cast<size_t>(city) * cached_;
+        for (uint32_t index{}; index < cached_; ++index)
+        {
+            neighbours_[offset + index] = nearest[index];
+            cache_[offset + index] = Compute(city, nearest[index]);
+        }
+    }
+}
+
+void CoordinateDistances::FindNearest(uint32_t city, uint32_t count, std::vector<uint32_t>& result) const
+{
+    const auto cities = static_cast<uint32_t>(points_.size());
+    count = std::min(count, cities == 0 ? 0 : cities - 1);
+
+    // The planar index finds the cities by the Euclidean distance, the others are compared with all the cities
+    std::vector<std::pair<uint32_t, uint32_t>> candidates;
+    if (index_)
+    {
+        index_->Nearest(points_[city], count, city, result);
+        for (const auto other : result)
+        {
+            candidates.emplace_back(Compute(city, other), other);
+        }
+    }
+    else
+    {
+        candidates.reserve(cities);
+        for (uint32_t other{}; other < cities; ++other)
+        {
+            if (other != city)
+            {
+                candidates.emplace_back(Compute(city, other), other);
+            }
+        }
+    }
+
+    std::partial_sort(candidates.begin(), candidates.begin() + count, candidates.end());
+    result.resize(count);
+    for (uint32_t index{}; index < count; ++index)
+    {
+        result[index] = candidates[index].second;
+    }
+}
+
+uint32_t CoordinateDistances::Compute(uint32_t from, uint32_t to) const noexcept
+{
+    if (from == to)
+    {
+        return 0;
+    }
+
+    const auto dx = points_[from].x - points_[to].x;
+    const auto dy = points_[from].y - points_[to].y;
+    switch (metric_)
+    {
+        case Metric::kEuclidean:
+            return Round(std::sqrt(dx * dx + dy * dy));
+        case Metric::kCeiling:
+            return static_cast<uint32_t>(std::ceil(std::sqrt(dx * dx + dy * dy)));
+        case Metric::kGeographic:
+        {
+            const auto& first = radians_[from];
+            const auto& second = radians_[to];
+            const auto q1 = std::cos(first.y - second.y);
+            const auto q2 = std::cos(first.x - second.x);
+            const auto q3 = std::cos(first.x + second.x);
+            return static_cast<uint32_t>(kEarthRadius * std::acos(0.5 * ((1.0 + q1) * q2 - (1.0 - q1) * q3)) + 1.0);
+        }
+        case Metric::kAtt:
+        {
+            const auto distance = std::sqrt((dx * dx + dy * dy) / 10.0);
+            const auto rounded = Round(distance);
+            return rounded < distance ? rounded + 1 : rounded;
+        }
+    }
+
+    return 0;
+}
+
+Metric ParseMetric(std::string_view name)
+{
+    if (name == "EUC_2D")
+    {
+        return Metric::kEuclidean;
+    }
+    if (name == "CEIL_2D")
+    {
+        return Metric::kCeiling;
+    }
+    if (name == "GEO")
+    {
+        return Metric::kGeographic;
+    }
+    if (name == "ATT")
+    {
+        return Metric::kAtt;
+    }
+
+    throw std::runtime_error("Unsupported edge weight type " + std::string{ name });
+}
+} // namespace tsp
@@ -0,0 +1,678 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "tsp/kernels.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define TSP_KERNELS_X86
+#include <immintrin.h>
+#endif
+
+namespace
+{
+using tsp::kernels::Level;
+
+/**
+ * @brief The gathers, from which all the kernels are built
+ *
+ * @tparam T the type of the values in the matrix
+ */
+template <class T> struct Primitives
+{
+    // output[k] += row[columns[k]]
+    void (*add_row)(const T* row, const uint32_t* columns, size_t count, int64_t* output);
+
+    // output[k] += column[rows[k] * stride]
+    void (*add_column)(const T* column, size_t stride, const uint32_t* rows, size_t count, int64_t* output);
+
+    // output[k] = matrix[from[k] * stride + to[k]]
+    void (*gather)(const T* matrix, size_t stride, const uint32_t* from, const uint32_t* to, size_t count,
+                   uint32_t* output);
+};
+
+namespace scalar
+{
+template <class T> void AddRow(const T* row, const uint32_t* columns, size_t count, int64_t* output)
+{
+    for (size_t k{}; k < count; ++k)
+    {
+        output[k] += row[columns[k]];
+    }
+}
+
+template <class T> void AddColumn(const T* column, size_t stride, const uint32_t* rows, size_t count, int64_t* output)
+{
+    for (size_t k{}; k < count; ++k)
+    {
+        output[k] += column[rows[k] * stride];
+    }
+}
+
+template <class T>
+void Gather(const T* matrix, size_t stride, const uint32_t* from, const uint32_t* to, size_t count, uint32_t* output)
+{
+    for (size_t k{}; k < count; ++k)
+    {
+        output[k] = matrix[from[k] * stride + to[k]];
+    }
+}
+
+template <class T> T MinPlus(const T* first, const T* second, size_t count)
+{
+    T result{ std::numeric_limits<T>::max() };
+    for (size_t k{}; k < count; ++k)
+    {
+        result = std::min(result, static_cast<T>(first[k] + second[k]));
+    }
+    return result;
+}
+} // namespace scalar
+
+#ifdef TSP_KERNELS_X86
+// The gathers of the narrow types load whole 32-bit words, which is why the matrices are padded, and mask them
+
+namespace sse4
+{
+// SSE4.1 has no gather instruction, so the values are loaded one by one and only the arithmetic is vectorised
+
+__attribute__((target("sse4.1"))) void Add(int64_t* output, __m128i values)
+{
+    auto* lo = reinterpret_cast<__m128i*>(output);
+    auto* hi = reinterpret_cast<__m128i*>(output + 2);
+    _mm_storeu_si128(lo, _mm_add_epi64(_mm_loadu_si128(lo), _mm_cvtepu32_epi64(values)));
+    _mm_storeu_si128(hi, _mm_add_epi64(_mm_loadu_si128(hi), _mm_cvtepu32_epi64(_mm_srli_si128(values, 8))));
+}
+
+template <class T> __attribute__((target("sse4.1"))) __m128i Load(const T* base, __m128i indices)
+{
+    return _mm_set_epi32(base[static_cast<uint32_t>(_mm_extract_epi32(indices, 3))],
+                         base[static_cast<uint32_t>(_mm_extract_epi32(indices, 2))],
+                         base[static_cast<uint32_t>(_mm_extract_epi32(indices, 1))],
+                         base[static_cast<uint32_t>(_mm_extract_epi32(indices, 0))]);
+}
+
+template <class T>
+__attribute__((target("sse4.1"))) void AddRow(const T* row, const uint32_t* columns, size_t count, int64_t* output)
+{
+    size_t k{};
+    for (; k + 4 <= count; k += 4)
+    {
+        const auto indices = _mm_loadu_si128(reinterpret_cast<const __m128i*>(columns + k));
+        Add(output + k, Load(row, indices));
+    }
+    scalar::AddRow(row, columns + k, count - k, output + k);
+}
+
+template <class T>
+__attribute__((target("sse4.1"))) void AddColumn(const T* column, size_t stride, const uint32_t* rows, size_t count,
+                                                 int64_t* output)
+{
+    const auto multiplier = _mm_set1_epi32(static_cast<int>(stride));
+    size_t k{};
+    for (; k + 4 <= count; k += 4)
+    {
+        const auto indices = _mm_mullo_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(rows + k)), multiplier);
+        Add(output + k, Load(column, indices));
+    }
+    scalar::AddColumn(column, stride, rows + k, count - k, output + k);
+}
+
+template <class T>
+__attribute__((target("sse4.1"))) void Gather(const T* matrix, size_t stride, const uint32_t* from,
+                                              const uint32_t* to, size_t count, uint32_t* output)
+{
+    const auto multiplier = _mm_set1_epi32(static_cast<int>(stride));
+    size_t k{};
+    for (; k + 4 <= count; k += 4)
+    {
+        const auto rows = _mm_loadu_si128(reinterpret_cast<const __m128i*>(from + k));
+        const auto columns = _mm_loadu_si128(reinterpret_cast<const __m128i*>(to + k));
+        const auto indices = _mm_add_epi32(_mm_mullo_epi32(rows, multiplier), columns);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + k), Load(matrix, indices));
+    }
+    scalar::Gather(matrix, stride, from + k, to + k, count - k, output + k);
+}
+
+template <class T> __attribute__((target("sse4.1"))) T MinPlus(const T* first, const T* second, size_t count)
+{
+    constexpr size_t kLanes{ sizeof(__m128i) / sizeof(T) };
+    auto minimum = _mm_set1_epi8(-1);
+    size_t k{};
+    for (; k + kLanes <= count; k += kLanes)
+    {
+        const auto left = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first + k));
+        const auto right = _mm_loadu_si128(reinterpret_cast<const __m128i*>(second + k));
+        if constexpr (sizeof(T) == sizeof(uint16_t))
+        {
+            minimum = _mm_min_epu16(minimum, _mm_add_epi16(left, right));
+        }
+        else
+        {
+            minimum = _mm_min_epu32(minimum, _mm_add_epi32(left, right));
+        }
+    }
+
+    alignas(sizeof(__m128i)) T lanes[kLanes];
+    _mm_store_si128(reinterpret_cast<__m128i*>(lanes), minimum);
+    return std::min(*std::min_element(lanes, lanes + kLanes), scalar::MinPlus(first + k, second + k, count - k));
+}
+} // namespace sse4
+
+namespace avx2
+{
+__attribute__((target("avx2"))) void Add(int64_t* output, __m256i values)
+{
+    auto* lo = reinterpret_cast<__m256i*>(output);
+    auto* hi = reinterpret_cast<__m256i*>(output + 4);
+    const auto lo_values = _mm256_cvtepu32_epi64(_mm256_castsi256_si128(values));
+    const auto hi_values = _mm256_cvtepu32_epi64(_mm256_extracti128_si256(values, 1));
+    _mm256_storeu_si256(lo, _mm256_add_epi64(_mm256_loadu_si256(lo), lo_values));
+    _mm256_storeu_si256(hi, _mm256_add_epi64(_mm256_loadu_si256(hi), hi_values));
+}
+
+template <class T> __attribute__((target("avx2"))) __m256i Load(const T* base, __m256i indices)
+{
+    const auto values = _mm256_i32gather_epi32(reinterpret_cast<const int*>(base), indices, sizeof(T));
+    if constexpr (sizeof(T) < sizeof(uint32_t))
+    {
+        return _mm256_and_si256(values, _mm256_set1_epi32(std::numeric_limits<T>::max()));
+    }
+    return values;
+}
+
+template <class T>
+__attribute__((target("avx2"))) void AddRow(const T* row, const uint32_t* columns, size_t count, int64_t* output)
+{
+    size_t k{};
+    for (; k + 8 <= count; k += 8)
+    {
+        const auto indices = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(columns + k));
+        Add(output + k, Load(row, indices));
+    }
+    scalar::AddRow(row, columns + k, count - k, output + k);
+}
+
+template <class T>
+__attribute__((target("avx2"))) void AddColumn(const T* column, size_t stride, const uint32_t* rows, size_t count,
+                                               int64_t* output)
+{
+    const auto multiplier = _mm256_set1_epi32(static_cast<int>(stride));
+    size_t k{};
+    for (; k + 8 <= count; k += 8)
+    {
+        const auto indices =
+            _mm256_mullo_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(rows + k)), multiplier);
+        Add(output + k, Load(column, indices));
+    }
+    scalar::AddColumn(column, stride, rows + k, count - k, output + k);
+}
+
+template <class T>
+__attribute__((target("avx2"))) void Gather(const T* matrix, size_t stride, const uint32_t* from, const uint32_t* to,
+                                            size_t count, uint32_t* output)
+{
+    const auto multiplier = _mm256_set1_epi32(static_cast<int>(stride));
+    size_t k{};
+    for (; k + 8 <= count; k += 8)
+    {
+        const auto rows = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(from + k));
+        const auto columns = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(to + k));
+        const auto indices = _mm256_add_epi32(_mm256_mullo_epi32(rows, multiplier), columns);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + k), Load(matrix, indices));
+    }
+    scalar::Gather(matrix, stride, from + k, to + k, count - k, output + k);
+}
+
+template <class T> __attribute__((target("avx2"))) T MinPlus(const T* first, const T* second, size_t count)
+{
+    constexpr size_t kLanes{ sizeof(__m256i) / sizeof(T) };
+    auto minimum = _mm256_set1_epi8(-1);
+    size_t k{};
+    for (; k + kLanes <= count; k += kLanes)
+    {
+        const auto left = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first + k));
+        const auto right = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(second + k));
+        if constexpr (sizeof(T) == sizeof(uint16_t))
+        {
+            minimum = _mm256_min_epu16(minimum, _mm256_add_epi16(left, right));
+        }
+        else
+        {
+            minimum = _mm256_min_epu32(minimum, _mm256_add_epi32(left, right));
+        }
+    }
+
+    alignas(sizeof(__m256i)) T lanes[kLanes];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), minimum);
+    return std::min(*std::min_element(lanes, lanes + kLanes), scalar::MinPlus(first + k, second + k, count - k));
+}
+} // namespace avx2
+
+namespace avx512
+{
+__attribute__((target("avx512f"))) void Add(int64_t* output, __m512i values)
+{
+    const auto lo = _mm512_cvtepu32_epi64(_mm512_castsi512_si256(values));
+    const auto hi = _mm512_cvtepu32_epi64(_mm512_extracti64x4_epi64(values, 1));
+    _mm512_storeu_si512(output, _mm512_add_epi64(_mm512_loadu_si512(output), lo));
+    _mm512_storeu_si512(output + 8, _mm512_add_epi64(_mm512_loadu_si512(output + 8), hi));
+}
+
+template <class T> __attribute__((target("avx512f"))) __m512i Load(const T* base, __m512i indices)
+{
+    const auto values = _mm512_i32gather_epi32(indices, base, sizeof(T));
+    if constexpr (sizeof(T) < sizeof(uint32_t))
+    {
+        return _mm512_and_si512(values, _mm512_set1_epi32(std::numeric_limits<T>::max()));
+    }
+    return values;
+}
+
+template <class T>
+__attribute__((target("avx512f"))) void AddRow(const T* row, const uint32_t* columns, size_t count, int64_t* output)
+{
+    size_t k{};
+    for (; k + 16 <= count; k += 16)
+    {
+        const auto indices = _mm512_loadu_si512(columns + k);
+        Add(output + k, Load(row, indices));
+    }
+    scalar::AddRow(row, columns + k, count - k, output + k);
+}
+
+template <class T>
+__attribute__((target("avx512f"))) void AddColumn(const T* column, size_t stride, const uint32_t* rows, size_t count,
+                                                  int64_t* output)
+{
+    const auto multiplier = _mm512_set1_epi32(static_cast<int>(stride));
+    size_t k{};
+    for (; k + 16 <= count; k += 16)
+    {
+        const auto indices = _mm512_mullo_epi32(_mm512_loadu_si512(rows + k), multiplier);
+        Add(output + k, Load(column, indices));
+    }
+    scalar::AddColumn(column, stride, rows + k, count - k, output + k);
+}
+
+template <class T>
+__attribute__((target("avx512f"))) void Gather(const T* matrix, size_t stride, const uint32_t* from,
+                                               const uint32_t* to, size_t count, uint32_t* output)
+{
+    const auto multiplier = _mm512_set1_epi32(static_cast<int>(stride));
+    size_t k{};
+    for (; k + 16 <= count; k += 16)
+    {
+        const auto rows = _mm512_loadu_si512(from + k);
+        const auto columns = _mm512_loadu_si512(to + k);
+        const auto indices = _mm512_add_epi32(_mm512_mullo_epi32(rows, multiplier), columns);
+        _mm512_storeu_si512(output + k, Load(matrix, indices));
+    }
+    scalar::Gather(matrix, stride, from + k, to + k, count - k, output + k);
+}
+
+// The minimum of the 16-bit values needs AVX-512BW, so only the 32-bit values have this kernel
+__attribute__((target("avx512f"))) uint32_t MinPlus(const uint32_t* first, const uint32_t* second, size_t count)
+{
+    constexpr size_t kLanes{ sizeof(__m512i) / sizeof(uint32_t) };
+    auto minimum = _mm512_set1_epi32(-1);
+    size_t k{};
+    for (; k + kLanes <= count; k += kLanes)
+    {
+        const auto sum = _mm512_add_epi32(_mm512_loadu_si512(first + k), _mm512_loadu_si512(second + k));
+        minimum = _mm512_min_epu32(minimum, sum);
+    }
+
+    return std::min(_mm512_reduce_min_epu32(minimum), scalar::MinPlus(first + k, second + k, count - k));
+}
+} // namespace avx512
+#endif
+
+template <class T> constexpr Primitives<T> kScalar{ scalar::AddRow<T>, scalar::AddColumn<T>, scalar::Gather<T> };
+#ifdef TSP_KERNELS_X86
+template <class T> constexpr Primitives<T> kSse4{ sse4::AddRow<T>, sse4::AddColumn<T>, sse4::Gather<T> };
+template <class T> constexpr Primitives<T> kAvx2{ avx2::AddRow<T>, avx2::AddColumn<T>, avx2::Gather<T> };
+template <class T> constexpr Primitives<T> kAvx512{ avx512::AddRow<T>, avx512::AddColumn<T>, avx512::Gather<T> };
+#endif
+
+Level Detect()
+{
+#ifdef TSP_KERNELS_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f"))
+    {
+        return Level::kAvx512;
+    }
+    if (__builtin_cpu_supports("avx2"))
+    {
+        return Level::kAvx2;
+    }
+    if (__builtin_cpu_supports("sse4.1"))
+    {
+        return Level::kSse4;
+    }
+#endif
+    return Level::kScalar;
+}
+
+std::atomic<Level>& CurrentLevel()
+{
+    static std::atomic<Level> level{ Detect() };
+    return level;
+}
+
+/**
+ * @brief Select the primitives for the matrix, the vector gathers use signed 32-bit indices
+ */
+template <class T> const Primitives<T>& Select(const math::Matrix<T>& matrix)
+{
+    if (matrix.Rows() * matrix.Columns() > static_cast<size_t>(std::numeric_limits<int32_t>::max()))
+    {
+        return kScalar<T>;
+    }
+
+#ifdef TSP_KERNELS_X86
+    switch (CurrentLevel().load(std::memory_order_relaxed))
+    {
+        case Level::kAvx512:
+            return kAvx512<T>;
+        case Level::kAvx2:
+            return kAvx2<T>;
+        case Level::kSse4:
+            return kSse4<T>;
+        case Level::kScalar:
+            break;
+    }
+#endif
+    return kScalar<T>;
+}
+
+// The primitives gather the stored offsets, so the kernels add the offset once for every gathered distance
+
+template <class T>
+uint64_t TourLength(const Primitives<T>& primitives, const tsp::DenseDistances<T>& distances, const uint32_t* tour,
+                    size_t size)
+{
+    if (size == 0)
+    {
+        return 0;
+    }
+
+    const auto& matrix = distances.GetMatrix();
+    uint32_t edges[tsp::kernels::kBlockSize];
+    uint64_t result{ distances(tour[size - 1], tour[0]) + static_cast<uint64_t>(size - 1) * distances.GetOffset() };
+    for (size_t first{}; first + 1 < size; first += tsp::kernels::kBlockSize)
+    {
+        const auto count = std::min(tsp::kernels::kBlockSize, size - 1 - first);
+        primitives.gather(matrix.data(), matrix.Columns(), tour + first, tour + first + 1, count, edges);
+        for (size_t k{}; k < count; ++k)
+        {
+            result += edges[k];
+        }
+    }
+
+    return result;
+}
+
+template <class T>
+void TourEdges(const Primitives<T>& primitives, const tsp::DenseDistances<T>& distances, const uint32_t* tour,
+               size_t size, uint32_t* forward, uint32_t* backward)
+{
+    if (size == 0)
+    {
+        return;
+    }
+
+    const auto& matrix = distances.GetMatrix();
+    const auto offset = distances.GetOffset();
+    primitives.gather(matrix.data(), matrix.Columns(), tour, tour + 1, size - 1, forward);
+    std::for_each(forward, forward + size - 1, [offset](uint32_t& edge) { edge += offset; });
+    forward[size - 1] = distances(tour[size - 1], tour[0]);
+
+    if (backward != nullptr)
+    {
+        primitives.gather(matrix.data(), matrix.Columns(), tour + 1, tour, size - 1, backward);
+        std::for_each(backward, backward + size - 1, [offset](uint32_t& edge) { edge += offset; });
+        backward[size - 1] = distances(tour[0], tour[size - 1]);
+    }
+}
+
+template <class T>
+void SwapDeltas(const Primitives<T>& primitives, const tsp::DenseDistances<T>& distances, const uint32_t* tour,
+                const uint32_t* edges, size_t i, size_t first, size_t count, int64_t* deltas)
+{
+    const auto* matrix = distances.GetMatrix().data();
+    const size_t stride = distances.GetMatrix().Columns();
+    const auto city = tour[i];
+    const auto before = tour[i - 1];
+    const auto after = tour[i + 1];
+    const int64_t offset = distances.GetOffset();
+
+    // The edges around both positions are removed
+    const int64_t base = -static_cast<int64_t>(edges[i - 1]) - edges[i] + 4 * offset;
+    for (size_t k{}; k < count; ++k)
+    {
+        deltas[k] = base - edges[first + k - 1] - edges[first + k];
+    }
+
+    // The cities are placed between the neighbours of each other
+    primitives.add_row(matrix + before * stride, tour + first, count, deltas);
+    primitives.add_column(matrix + after, stride, tour + first, count, deltas);
+    primitives.add_column(matrix + city, stride, tour + first - 1, count, deltas);
+    primitives.add_row(matrix + city * stride, tour + first + 1, count, deltas);
+}
+
+template <class T>
+void ReversalDeltas(const Primitives<T>& primitives, const tsp::DenseDistances<T>& distances, const uint32_t* tour,
+                    const uint32_t* edges, const int64_t* forward, const int64_t* backward, size_t i, size_t first,
+                    size_t count, int64_t* deltas)
+{
+    const auto* matrix = distances.GetMatrix().data();
+    const size_t stride = distances.GetMatrix().Columns();
+    const auto before = tour[i - 1];
+    const auto head = tour[i];
+    const int64_t offset = distances.GetOffset();
+
+    // The edges at both ends of the segment are removed and its inner edges change the direction
+    const int64_t base = -static_cast<int64_t>(edges[i - 1]) + forward[i] - backward[i] + 2 * offset;
+    for (size_t k{}; k < count; ++k)
+    {
+        const auto j = first + k;
+        deltas[k] = base - edges[j] + backward[j] - forward[j];
+    }
+
+    primitives.add_row(matrix + before * stride, tour + first, count, deltas);
+    primitives.add_row(matrix + head * stride, tour + first + 1, count, deltas);
+}
+
+template <class T>
+void InsertionDeltas(const Primitives<T>& primitives, const tsp::DenseDistances<T>& distances, const uint32_t* tour,
+                     const uint32_t* edges, size_t i, size_t length, size_t first, size_t count, int64_t* deltas)
+{
+    const auto* matrix = distances.GetMatrix().data();
+    const size_t stride = distances.GetMatrix().Columns();
+    const auto previous = tour[i - 1];
+    const auto head = tour[i];
+    const auto tail = tour[i + length - 1];
+    const auto next = tour[(i + length) % distances.Size()];
+    const int64_t offset = distances.GetOffset();
+
+    // The segment is cut out and its neighbours are connected
+    const int64_t base =
+        static_cast<int64_t>(distances(previous, next)) - edges[i - 1] - edges[i + length - 1] + 2 * offset;
+    for (size_t k{}; k < count; ++k)
+    {
+        deltas[k] = base - edges[first + k];
+    }
+
+    primitives.add_column(matrix + head, stride, tour + first, count, deltas);
+    primitives.add_row(matrix + tail * stride, tour + first + 1, count, deltas);
+}
+
+#ifdef TSP_VERIFY_MOVES
+void VerifyDeltas(const int64_t* deltas, const int64_t* expected, size_t count)
+{
+    if (!std::equal(deltas, deltas + count, expected))
+    {
+        throw std::logic_error("The vectorised deltas do not match the scalar ones");
+    }
+}
+#endif
+} // namespace
+
+namespace tsp::kernels
+{
+Level GetLevel()
+{
+    return CurrentLevel().load(std::memory_order_relaxed);
+}
+
+void SetLevel(Level level)
+{
+    CurrentLevel().store(std::min(level, Detect()), std::memory_order_relaxed);
+}
+
+Level ParseLevel(const std::string& name)
+{
+    if (name == "scalar")
+    {
+        return Level::kScalar;
+    }
+    if (name == "sse4")
+    {
+        return Level::kSse4;
+    }
+    if (name == "avx2")
+    {
+        return Level::kAvx2;
+    }
+    if (name == "avx512")
+    {
+        return Level::kAvx512;
+    }
+
+    throw std::runtime_error("Unknown instruction set " + name);
+}
+
+template <class T> uint64_t TourLength(const DenseDistances<T>& distances, const uint32_t* tour, size_t size)
+{
+    const auto result = ::TourLength(Select(distances.GetMatrix()), distances, tour, size);
+
+#ifdef TSP_VERIFY_MOVES
+    if (result != ::TourLength(kScalar<T>, distances, tour, size))
+    {
+        throw std::logic_error("The vectorised tour length does not match the scalar one");
+    }
+#endif
+
+    return result;
+}
+
+template <class T>
+void TourEdges(const DenseDistances<T>& distances, const uint32_t* tour, size_t size, uint32_t* forward,
+               uint32_t* backward)
+{
+    ::TourEdges(Select(distances.GetMatrix()), distances, tour, size, forward, backward);
+}
+
+template <class T>
+void SwapDeltas(const DenseDistances<T>& distances, const uint32_t* tour, const uint32_t* edges, size_t i,
+                size_t first, size_t count, int64_t* deltas)
+{
+    ::SwapDeltas(Select(distances.GetMatrix()), distances, tour, edges, i, first, count, deltas);
+
+#ifdef TSP_VERIFY_MOVES
+    int64_t expected[kBlockSize];
+    ::SwapDeltas(kScalar<T>, distances, tour, edges, i, first, count, expected);
+    VerifyDeltas(deltas, expected, count);
+#endif
+}
+
+template <class T>
+void ReversalDeltas(const DenseDistances<T>& distances, const uint32_t* tour, const uint32_t* edges,
+                    const int64_t* forward, const int64_t* backward, size_t i, size_t first, size_t count,
+                    int64_t* deltas)
+{
+    ::ReversalDeltas(Select(distances.GetMatrix()), distances, tour, edges, forward, backward, i, first, count,
+                     deltas);
+
+#ifdef TSP_VERIFY_MOVES
+    int64_t expected[kBlockSize];
+    ::ReversalDeltas(kScalar<T>, distances, tour, edges, forward, backward, i, first, count, expected);
+    VerifyDeltas(deltas, expected, count);
+#endif
+}
+
+template <class T>
+void InsertionDeltas(const DenseDistances<T>& distances, const uint32_t* tour, const uint32_t* edges, size_t i,
+                     size_t length, size_t first, size_t count, int64_t* deltas)
+{
+    ::InsertionDeltas(Select(distances.GetMatrix()), distances, tour, edges, i, length, first, count, deltas);
+
+#ifdef TSP_VERIFY_MOVES
+    int64_t expected[kBlockSize];
+    ::InsertionDeltas(kScalar<T>, distances, tour, edges, i, length, first, count, expected);
+    VerifyDeltas(deltas, expected, count);
+#endif
+}
+
+template <class T> MinPlusKernel<T> GetMinPlus()
+{
+#ifdef TSP_KERNELS_X86
+    switch (CurrentLevel().load(std::memory_order_relaxed))
+    {
+        case Level::kAvx512:
+            if constexpr (std::is_same_v<T, uint32_t>)
+            {
+                return avx512::MinPlus;
+            }
+            return avx2::MinPlus<T>;
+        case Level::kAvx2:
+            return avx2::MinPlus<T>;
+        case Level::kSse4:
+            return sse4::MinPlus<T>;
+        case Level::kScalar:
+            break;
+    }
+#endif
+    return scalar::MinPlus<T>;
+}
+
+template MinPlusKernel<uint16_t> GetMinPlus<uint16_t>();
+template MinPlusKernel<uint32_t> GetMinPlus<uint32_t>();
+
+#define TSP_INSTANTIATE_KERNELS(T)                                                                                     \
+    template uint64_t TourLength(const DenseDistances<T>&, const uint32_t*, size_t);                                   \
+    template void TourEdges(const DenseDistances<T>&, const uint32_t*, size_t, uint32_t*, uint32_t*);                  \
+    template void SwapDeltas(const DenseDistances<T>&, const uint32_t*, const uint32_t*, size_t, size_t, size_t,       \
+                             int64_t*);                                                                                \
+    template void ReversalDeltas(const DenseDistances<T>&, const uint32_t*, const uint32_t*, const int64_t*,           \
+                                 const int64_t*, size_t, size_t, size_t, int64_t*);                                    \
+    template void InsertionDeltas(const DenseDistances<T>&, const uint32_t*, const uint32_t*, size_t, size_t, size_t,  \
+                                  size_t, int64_t*)
+
+TSP_INSTANTIATE_KERNELS(uint8_t);
+TSP_INSTANTIATE_KERNELS(uint16_t);
+TSP_INSTANTIATE_KERNELS(uint32_t);
+} // namespace tsp::kernels
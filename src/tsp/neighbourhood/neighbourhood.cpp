@@ -0,0 +1,166 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "tsp/neighbourhood/neighbourhood.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+#include "tsp/kernels.hpp"
+#include "tsp/neighbourhood/oropt.hpp"
+#include "tsp/neighbourhood/swap.hpp"
+#include "tsp/neighbourhood/twoopt.hpp"
+
+namespace tsp::neighbourhood
+{
+template <class Distances>
+Neighbourhood<Distances>::Neighbourhood(const Distances& distances, uint32_t tenure)
+    : distances_{ distances }, tabus_{ static_cast<uint32_t>(distances.Size()), tenure }
+{
+}
+
+template <class Distances> void Neighbourhood<Distances>::SetCandidates(std::shared_ptr<const CandidateList> candidates)
+{
+    candidates_ = std::move(candidates);
+}
+
+template <class Distances> void Neighbourhood<Distances>::SetDontLookBits(bool enabled)
+{
+    dont_look_.assign(enabled ? distances_.Size() : 0, 0);
+}
+
+template <class Distances> void Neighbourhood<Distances>::Prepare(const Tour& tour)
+{
+    edges_.resize(tour.size());
+    kernels::TourEdges(distances_, tour.data(), tour.size(), edges_.data(), nullptr);
+}
+
+template <class Distances>
+Candidates Neighbourhood<Distances>::Scan(const Tour& tour, int64_t aspiration, size_t first, size_t step)
+{
+    const size_t size = tour.size();
+    Candidates result;
+
+    for (size_t row = first; row < size; row += step)
+    {
+        const auto city = tour[row];
+        if (!dont_look_.empty() && dont_look_[city] != 0)
+        {
+            continue;
+        }
+
+        const bool improving = candidates_ == nullptr ? ScanRow(tour, aspiration, row, result)
+                                                      : ScanCandidateRow(tour, aspiration, row, result);
+        if (!dont_look_.empty() && !improving)
+        {
+            dont_look_[city] = 1;
+        }
+    }
+
+    return result;
+}
+
+template <class Distances> void Neighbourhood<Distances>::SetTenure(uint32_t tenure) noexcept
+{
+    tabus_.SetTenure(tenure);
+}
+
+template <class Distances> void Neighbourhood<Distances>::Apply(Tour& tour, const Move& move)
+{
+    Record(tour, move);
+    Perform(tour, move);
+}
+
+template <class Distances> void Neighbourhood<Distances>::Advance()
+{
+    tabus_.Advance();
+}
+
+template <class Distances> void Neighbourhood<Distances>::Clear()
+{
+    tabus_.Clear();
+    ResetDontLookBits();
+}
+
+template <class Distances> void Neighbourhood<Distances>::ResetDontLookBits()
+{
+    std::fill(dont_look_.begin(), dont_look_.end(), 0);
+}
+
+#ifdef TSP_VERIFY_MOVES
+template <class Distances> void Neighbourhood<Distances>::Verify(Tour tour, const Move& move) const
+{
+    const auto weight = [this](const Tour& value) {
+        int64_t result{};
+        for (size_t i = 0; i < value.size(); i++)
+        {
+            result += distances_(value[i], value[(i + 1) % value.size()]);
+        }
+        return result;
+    };
+
+    const auto before = weight(tour);
+    Perform(tour, move);
+    if (weight(tour) - before != move.delta)
+    {
+        throw std::logic_error("The delta of the move does not match the recalculated weight");
+    }
+}
+#endif
+
+Type ParseType(const std::string& name)
+{
+    if (name == "swap")
+    {
+        return Type::kSwap;
+    }
+    if (name == "2opt")
+    {
+        return Type::kTwoOpt;
+    }
+    if (name == "oropt")
+    {
+        return Type::kOrOpt;
+    }
+
+    throw std::runtime_error("Unknown neighbourhood " + name);
+}
+
+template <class Distances>
+std::unique_ptr<Neighbourhood<Distances>> Create(Type type, const Distances& distances, uint32_t tenure)
+{
+    switch (type)
+    {
+        case Type::kSwap:
+            return std::make_unique<Swap<Distances>>(distances, tenure);
+        case Type::kTwoOpt:
+            return std::make_unique<TwoOpt<Distances>>(distances, tenure);
+        case Type::kOrOpt:
+            return std::make_unique<OrOpt<Distances>>(distances, tenure);
+    }
+
+    throw std::runtime_error("Unknown neighbourhood");
+}
+
+#define TSP_INSTANTIATE(Distances)                                                                                     \
+    template class Neighbourhood<Distances>;                                                                           \
+    template std::unique_ptr<Neighbourhood<Distances>> Create(Type, const Distances&, uint32_t);
+TSP_FOR_EACH_DISTANCES(TSP_INSTANTIATE)
+} // namespace tsp::neighbourhood
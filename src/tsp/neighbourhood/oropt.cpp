@@ -0,0 +1,166 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "tsp/neighbourhood/oropt.hpp"
+
+#include <algorithm>
+#include <initializer_list>
+
+#include "tsp/kernels.hpp"
+
+namespace tsp::neighbourhood
+{
+template <class Distances>
+bool OrOpt<Distances>::ScanRow(const Tour& tour, int64_t aspiration, size_t row, Candidates& result) const
+{
+    const size_t size = tour.size();
+    bool improving{};
+
+    for (size_t length = 1; length <= kMaxSegmentLength && row + length <= size; length++)
+    {
+        // The insertions before and after the segment are evaluated in blocks, the end of the tour separately
+        improving |= CheckRange(tour, aspiration, row, length, 0, row - 1, result);
+        improving |= CheckRange(tour, aspiration, row, length, row + length, size - 1, result);
+        improving |= Check(tour, aspiration, row, length, size - 1, result);
+    }
+
+    return improving;
+}
+
+template <class Distances>
+bool OrOpt<Distances>::CheckRange(const Tour& tour, int64_t aspiration, size_t i, size_t length, size_t first,
+                                  size_t last, Candidates& result) const
+{
+    bool improving{};
+    int64_t deltas[kernels::kBlockSize];
+    for (; first < last; first += kernels::kBlockSize)
+    {
+        const auto count = std::min(kernels::kBlockSize, last - first);
+        kernels::InsertionDeltas(distances_, tour.data(), edges_.data(), i, length, first, count, deltas);
+        for (size_t k{}; k < count; ++k)
+        {
+            improving |= Check(tour, aspiration, i, length, first + k, deltas[k], result);
+        }
+    }
+
+    return improving;
+}
+
+template <class Distances>
+bool OrOpt<Distances>::ScanCandidateRow(const Tour& tour, int64_t aspiration, size_t row, Candidates& result) const
+{
+    const size_t size = tour.size();
+    bool improving{};
+
+    for (size_t length = 1; length <= kMaxSegmentLength && row + length <= size; length++)
+    {
+        for (const auto predecessor : candidates_->Predecessors(tour[row]))
+        {
+            improving |= Check(tour, aspiration, row, length, tour.Position(predecessor), result);
+        }
+
+        for (const auto successor : candidates_->Successors(tour[row + length - 1]))
+        {
+            const auto after = (tour.Position(successor) + size - 1) % size;
+            improving |= Check(tour, aspiration, row, length, after, result);
+        }
+    }
+
+    return improving;
+}
+
+template <class Distances>
+bool OrOpt<Distances>::Check(const Tour& tour, int64_t aspiration, size_t i, size_t length, size_t after,
+                             Candidates& result) const
+{
+    // Inserting the segment after its own predecessor or inside of itself changes nothing
+    if (after + 1 >= i && after < i + length)
+    {
+        return false;
+    }
+
+    return Check(tour, aspiration, i, length, after, CalculateDelta(tour, i, length, after), result);
+}
+
+template <class Distances>
+bool OrOpt<Distances>::Check(const Tour& tour, int64_t aspiration, size_t i, size_t length, size_t after, int64_t delta,
+                             Candidates& result) const
+{
+    const Move move{ delta, static_cast<uint32_t>(i), static_cast<uint32_t>(length), static_cast<uint32_t>(after) };
+
+    // The move is forbidden when it restores a recently removed edge
+    const auto is_tabu = [this, &tour, i, length, after]() {
+        const auto before = tour[after];
+        const auto following = tour[(after + 1) % tour.size()];
+        return tabus_.IsTabu(before, tour[i]) || tabus_.IsTabu(tour[i + length - 1], following);
+    };
+    Consider(tour, move, aspiration, is_tabu, result);
+
+    return delta < 0;
+}
+
+template <class Distances>
+int64_t OrOpt<Distances>::CalculateDelta(const Tour& tour, size_t i, size_t length, size_t after) const
+{
+    const size_t size = tour.size();
+    const auto previous = tour[(i + size - 1) % size];
+    const auto head = tour[i];
+    const auto tail = tour[i + length - 1];
+    const auto next = tour[(i + length) % size];
+    const auto before = tour[after];
+    const auto following = tour[(after + 1) % size];
+
+    const int64_t removed = static_cast<int64_t>(distances_(previous, head)) + distances_(tail, next) +
+                            distances_(before, following);
+    const int64_t added = static_cast<int64_t>(distances_(previous, next)) + distances_(before, head) +
+                          distances_(tail, following);
+
+    return added - removed;
+}
+
+template <class Distances>
+std::array<uint32_t, 4> OrOpt<Distances>::GetChangedCities(const Tour& tour, const Move& move) const
+{
+    const size_t size = tour.size();
+    return { tour[(move.i + size - 1) % size], tour[move.i], tour[move.i + move.j - 1], tour[move.k] };
+}
+
+template <class Distances> void OrOpt<Distances>::Record(const Tour& tour, const Move& move)
+{
+    const size_t size = tour.size();
+    const auto previous = tour[(move.i + size - 1) % size];
+    const auto head = tour[move.i];
+    const auto tail = tour[move.i + move.j - 1];
+    const auto next = tour[(move.i + move.j) % size];
+    tabus_.Add(previous, head);
+    tabus_.Add(tail, next);
+
+    for (const auto city : { previous, head, tail, next, tour[move.k], tour[(move.k + 1) % size] })
+    {
+        Wake(city);
+    }
+}
+
+template <class Distances> void OrOpt<Distances>::Perform(Tour& tour, const Move& move) const
+{
+    tour.Move(move.i, move.j, move.k);
+}
+#define TSP_INSTANTIATE(Distances) template class OrOpt<Distances>;
+TSP_FOR_EACH_DISTANCES(TSP_INSTANTIATE)
+} // namespace tsp::neighbourhood
@@ -0,0 +1,175 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "tsp/neighbourhood/swap.hpp"
+
+#include <algorithm>
+#include <initializer_list>
+#include <utility>
+
+#include "tsp/kernels.hpp"
+
+namespace tsp::neighbourhood
+{
+template <class Distances>
+bool Swap<Distances>::ScanRow(const Tour& tour, int64_t aspiration, size_t row, Candidates& result) const
+{
+    const size_t size = tour.size();
+    bool improving{};
+    if (row + 1 >= size)
+    {
+        return improving;
+    }
+
+    improving |= Check(tour, aspiration, row, row + 1, CalculateDelta(tour, row, row + 1), result);
+
+    // The positions, which are not adjacent to the row and to the end of the tour, are evaluated in blocks
+    int64_t deltas[kernels::kBlockSize];
+    for (size_t first = row + 2; first + 1 < size; first += kernels::kBlockSize)
+    {
+        const auto count = std::min(kernels::kBlockSize, size - 1 - first);
+        kernels::SwapDeltas(distances_, tour.data(), edges_.data(), row, first, count, deltas);
+        for (size_t k{}; k < count; ++k)
+        {
+            improving |= Check(tour, aspiration, row, first + k, deltas[k], result);
+        }
+    }
+
+    if (row + 2 < size)
+    {
+        improving |= Check(tour, aspiration, row, size - 1, CalculateDelta(tour, row, size - 1), result);
+    }
+
+    return improving;
+}
+
+template <class Distances>
+bool Swap<Distances>::ScanCandidateRow(const Tour& tour, int64_t aspiration, size_t row, Candidates& result) const
+{
+    const size_t size = tour.size();
+    const auto city = tour[row];
+    bool improving{};
+
+    // Put the city in front of one of its successors
+    for (const auto successor : candidates_->Successors(city))
+    {
+        const auto j = (tour.Position(successor) + size - 1) % size;
+        if (j != 0 && j != row)
+        {
+            improving |= Check(tour, aspiration, row, j, CalculateDelta(tour, row, j), result);
+        }
+    }
+
+    // Put the city behind one of its predecessors
+    for (const auto predecessor : candidates_->Predecessors(city))
+    {
+        const auto j = (tour.Position(predecessor) + 1) % size;
+        if (j != 0 && j != row)
+        {
+            improving |= Check(tour, aspiration, row, j, CalculateDelta(tour, row, j), result);
+        }
+    }
+
+    return improving;
+}
+
+template <class Distances>
+bool Swap<Distances>::Check(const Tour& tour, int64_t aspiration, size_t i, size_t j, int64_t delta,
+                            Candidates& result) const
+{
+    if (i > j)
+    {
+        std::swap(i, j);
+    }
+
+    const Move move{ delta, static_cast<uint32_t>(i), static_cast<uint32_t>(j) };
+    Consider(tour, move, aspiration, [this, &tour, i, j]() { return tabus_.IsTabu(tour[i], tour[j]); }, result);
+
+    return delta < 0;
+}
+
+template <class Distances> int64_t Swap<Distances>::CalculateDelta(const Tour& tour, size_t i, size_t j) const
+{
+    const size_t size = tour.size();
+    if (i > j)
+    {
+        std::swap(i, j);
+    }
+
+    const auto first = tour[i];
+    const auto second = tour[j];
+    const auto before_first = tour[(i + size - 1) % size];
+    const auto after_first = tour[(i + 1) % size];
+    const auto before_second = tour[(j + size - 1) % size];
+    const auto after_second = tour[(j + 1) % size];
+
+    int64_t removed{}, added{};
+    if (j == i + 1)
+    {
+        // The cities are neighbours: before_first -> first -> second -> after_second
+        removed = static_cast<int64_t>(distances_(before_first, first)) + distances_(first, second) +
+                  distances_(second, after_second);
+        added = static_cast<int64_t>(distances_(before_first, second)) + distances_(second, first) +
+                distances_(first, after_second);
+    }
+    else if (i == 0 && j == size - 1)
+    {
+        // The cities are neighbours over the end of the tour: before_second -> second -> first -> after_first
+        removed = static_cast<int64_t>(distances_(before_second, second)) + distances_(second, first) +
+                  distances_(first, after_first);
+        added = static_cast<int64_t>(distances_(before_second, first)) + distances_(first, second) +
+                distances_(second, after_first);
+    }
+    else
+    {
+        removed = static_cast<int64_t>(distances_(before_first, first)) + distances_(first, after_first) +
+                  distances_(before_second, second) + distances_(second, after_second);
+        added = static_cast<int64_t>(distances_(before_first, second)) + distances_(second, after_first) +
+                distances_(before_second, first) + distances_(first, after_second);
+    }
+
+    return added - removed;
+}
+
+template <class Distances>
+std::array<uint32_t, 4> Swap<Distances>::GetChangedCities(const Tour& tour, const Move& move) const
+{
+    return { tour[move.i], tour[move.j], tour[move.i], tour[move.j] };
+}
+
+template <class Distances> void Swap<Distances>::Record(const Tour& tour, const Move& move)
+{
+    const size_t size = tour.size();
+    tabus_.Add(tour[move.i], tour[move.j]);
+
+    for (const auto position : { move.i, move.j })
+    {
+        Wake(tour[(position + size - 1) % size]);
+        Wake(tour[position]);
+        Wake(tour[(position + 1) % size]);
+    }
+}
+
+template <class Distances> void Swap<Distances>::Perform(Tour& tour, const Move& move) const
+{
+    tour.Swap(move.i, move.j);
+}
+#define TSP_INSTANTIATE(Distances) template class Swap<Distances>;
+TSP_FOR_EACH_DISTANCES(TSP_INSTANTIATE)
+} // namespace tsp::neighbourhood
@@ -0,0 +1,178 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "tsp/neighbourhood/twoopt.hpp"
+
+#include <algorithm>
+
+#include "tsp/kernels.hpp"
+
+namespace tsp::neighbourhood
+{
+template <class Distances> void TwoOpt<Distances>::Prepare(const Tour& tour)
+{
+    const size_t size = tour.size();
+    edges_.resize(size);
+    backward_edges_.resize(size);
+    forward_.resize(size);
+    backward_.resize(size);
+
+    if (size == 0)
+    {
+        return;
+    }
+
+    kernels::TourEdges(distances_, tour.data(), size, edges_.data(), backward_edges_.data());
+
+    forward_[0] = backward_[0] = 0;
+    for (size_t position = 1; position < size; position++)
+    {
+        forward_[position] = forward_[position - 1] + edges_[position - 1];
+        backward_[position] = backward_[position - 1] + backward_edges_[position - 1];
+    }
+}
+
+template <class Distances>
+bool TwoOpt<Distances>::ScanRow(const Tour& tour, int64_t aspiration, size_t row, Candidates& result) const
+{
+    const size_t size = tour.size();
+    bool improving{};
+
+    // The segments, which do not end at the end of the tour, are evaluated in blocks
+    int64_t deltas[kernels::kBlockSize];
+    for (size_t first = row + 1; first + 1 < size; first += kernels::kBlockSize)
+    {
+        const auto count = std::min(kernels::kBlockSize, size - 1 - first);
+        kernels::ReversalDeltas(distances_, tour.data(), edges_.data(), forward_.data(), backward_.data(), row, first,
+                                count, deltas);
+        for (size_t k{}; k < count; ++k)
+        {
+            improving |= Check(tour, aspiration, row, first + k, deltas[k], result);
+        }
+    }
+
+    if (row + 1 < size)
+    {
+        improving |= Check(tour, aspiration, row, size - 1, CalculateDelta(tour, row, size - 1), result);
+    }
+
+    return improving;
+}
+
+template <class Distances>
+bool TwoOpt<Distances>::ScanCandidateRow(const Tour& tour, int64_t aspiration, size_t row, Candidates& result) const
+{
+    const size_t size = tour.size();
+    const auto city = tour[row];
+    bool improving{};
+
+    // Connect the predecessor of the segment starting at the row with the new first city of the segment
+    for (const auto successor : candidates_->Successors(tour[row - 1]))
+    {
+        const size_t j = tour.Position(successor);
+        if (j > row)
+        {
+            improving |= Check(tour, aspiration, row, j, CalculateDelta(tour, row, j), result);
+        }
+    }
+
+    // Connect the city, which becomes the last one of the segment, with the city after the segment
+    for (const auto successor : candidates_->Successors(city))
+    {
+        const auto j = (tour.Position(successor) + size - 1) % size;
+        if (j > row)
+        {
+            improving |= Check(tour, aspiration, row, j, CalculateDelta(tour, row, j), result);
+        }
+    }
+
+    // Connect the predecessor of a segment ending at the row with the city, which becomes its first one
+    for (const auto predecessor : candidates_->Predecessors(city))
+    {
+        const auto i = tour.Position(predecessor) + 1;
+        if (i < row)
+        {
+            improving |= Check(tour, aspiration, i, row, CalculateDelta(tour, i, row), result);
+        }
+    }
+
+    return improving;
+}
+
+template <class Distances>
+bool TwoOpt<Distances>::Check(const Tour& tour, int64_t aspiration, size_t i, size_t j, int64_t delta,
+                              Candidates& result) const
+{
+    const Move move{ delta, static_cast<uint32_t>(i), static_cast<uint32_t>(j) };
+
+    // The move is forbidden when it restores a recently removed edge
+    const auto is_tabu = [this, &tour, i, j]() {
+        const auto before = tour[i - 1];
+        const auto after = tour[(j + 1) % tour.size()];
+        return tabus_.IsTabu(before, tour[j]) || tabus_.IsTabu(tour[i], after);
+    };
+    Consider(tour, move, aspiration, is_tabu, result);
+
+    return delta < 0;
+}
+
+template <class Distances> int64_t TwoOpt<Distances>::CalculateDelta(const Tour& tour, size_t i, size_t j) const
+{
+    const size_t size = tour.size();
+    const auto before = tour[(i + size - 1) % size];
+    const auto first = tour[i];
+    const auto last = tour[j];
+    const auto after = tour[(j + 1) % size];
+
+    const int64_t removed = static_cast<int64_t>(distances_(before, first)) + distances_(last, after) +
+                            (forward_[j] - forward_[i]);
+    const int64_t added = static_cast<int64_t>(distances_(before, last)) + distances_(first, after) +
+                          (backward_[j] - backward_[i]);
+
+    return added - removed;
+}
+
+template <class Distances>
+std::array<uint32_t, 4> TwoOpt<Distances>::GetChangedCities(const Tour& tour, const Move& move) const
+{
+    // The reversed segment keeps its inner edges, only the edges at its ends change
+    return { tour[move.i], tour[move.j], tour[move.i], tour[move.j] };
+}
+
+template <class Distances> void TwoOpt<Distances>::Record(const Tour& tour, const Move& move)
+{
+    const size_t size = tour.size();
+    const auto before = tour[(move.i + size - 1) % size];
+    const auto after = tour[(move.j + 1) % size];
+    tabus_.Add(before, tour[move.i]);
+    tabus_.Add(tour[move.j], after);
+
+    Wake(before);
+    Wake(tour[move.i]);
+    Wake(tour[move.j]);
+    Wake(after);
+}
+
+template <class Distances> void TwoOpt<Distances>::Perform(Tour& tour, const Move& move) const
+{
+    tour.Reverse(move.i, move.j);
+}
+#define TSP_INSTANTIATE(Distances) template class TwoOpt<Distances>;
+TSP_FOR_EACH_DISTANCES(TSP_INSTANTIATE)
+} // namespace tsp::neighbourhood
@@ -0,0 +1,77 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "tsp/tour.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+namespace tsp
+{
+Tour::Tour(Cities cities)
+    : cities_{ std::move(cities) }, positions_(cities_.size(), static_cast<uint32_t>(cities_.size()))
+{
+    for (size_t position{}; position < cities_.size(); ++position)
+    {
+        const auto city = cities_[position];
+        if (city >= cities_.size() || positions_[city] != cities_.size())
+        {
+            throw std::runtime_error("The tour is not a permutation of the cities");
+        }
+
+        positions_[city] = static_cast<uint32_t>(position);
+    }
+}
+
+void Tour::Reverse(size_t i, size_t j) noexcept
+{
+    std::reverse(cities_.begin() + i, cities_.begin() + j + 1);
+    UpdatePositions(i, j + 1);
+}
+
+void Tour::Move(size_t first, size_t length, size_t after) noexcept
+{
+    const auto begin = cities_.begin();
+    if (after >= first + length)
+    {
+        std::rotate(begin + first, begin + first + length, begin + after + 1);
+        UpdatePositions(first, after + 1);
+    }
+    else
+    {
+        std::rotate(begin + after + 1, begin + first, begin + first + length);
+        UpdatePositions(after + 1, first + length);
+    }
+}
+
+void Tour::Rotate(City city) noexcept
+{
+    std::rotate(cities_.begin(), cities_.begin() + positions_[city], cities_.end());
+    UpdatePositions(0, cities_.size());
+}
+
+void Tour::UpdatePositions(size_t first, size_t last) noexcept
+{
+    for (size_t position{ first }; position < last; ++position)
+    {
+        positions_[cities_[position]] = static_cast<uint32_t>(position);
+    }
+}
+} // namespace tsp
@@ -0,0 +1,92 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "tsp/tourhash.hpp"
+
+#include <algorithm>
+#include <array>
+#include <utility>
+
+#include "utils/random.hpp"
+
+namespace
+{
+uint64_t Mix(uint64_t value) noexcept
+{
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+    return value ^ (value >> 31);
+}
+} // namespace
+
+namespace tsp
+{
+TourHash::TourHash(uint32_t cities, uint64_t seed) : keys_(cities)
+{
+    utils::Random random{ seed };
+    for (auto& key : keys_)
+    {
+        key = random();
+    }
+}
+
+uint64_t TourHash::operator()(const Tour& tour) const noexcept
+{
+    uint64_t hash{};
+    for (size_t position{}; position < tour.size(); ++position)
+    {
+        hash ^= GetKey(tour[position], tour[(position + 1) % tour.size()]);
+    }
+
+    return hash;
+}
+
+uint64_t TourHash::Incident(const Tour& tour, std::span<const uint32_t> cities) const noexcept
+{
+    const size_t size = tour.size();
+    std::array<std::pair<uint32_t, uint32_t>, kMaxCities * 2> edges;
+    size_t count{};
+    for (const auto city : cities.first(std::min(cities.size(), kMaxCities)))
+    {
+        const auto position = tour.Position(city);
+        for (const auto other : { tour[(position + size - 1) % size], tour[(position + 1) % size] })
+        {
+            edges[count++] = std::minmax(city, other);
+        }
+    }
+
+    // The edge between two of the cities would be found twice and cancel itself out
+    std::sort(edges.begin(), edges.begin() + count);
+    const auto end = std::unique(edges.begin(), edges.begin() + count);
+
+    uint64_t hash{};
+    for (auto edge = edges.begin(); edge != end; ++edge)
+    {
+        hash ^= GetKey(edge->first, edge->second);
+    }
+
+    return hash;
+}
+
+uint64_t TourHash::GetKey(uint32_t first, uint32_t second) const noexcept
+{
+    // The sum does not depend on the order of the cities, the mixing keeps the keys of the edges independent
+    return Mix(keys_[first] + keys_[second]);
+}
+} // namespace tsp
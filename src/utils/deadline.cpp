@@ -0,0 +1,53 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "utils/deadline.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace utils
+{
+Deadline::Deadline(Clock::duration limit, Clock::duration max_overshoot, std::shared_ptr<const CancellationToken> token)
+    : end_{ Clock::now() + limit }, max_overshoot_{ max_overshoot }, token_{ std::move(token) },
+      last_check_{ end_ - limit }
+{
+}
+
+bool Deadline::Check() noexcept
+{
+    const auto now = Clock::now();
+    if (now >= end_)
+    {
+        expired_ = true;
+        countdown_ = 1;
+        return true;
+    }
+
+    // The next read should come before the overshoot passes, but not after the deadline
+    const auto iteration = std::max<Clock::rep>((now - last_check_).count() / stride_, 1);
+    const auto budget = std::min(max_overshoot_, end_ - now).count();
+    const auto stride = std::clamp<Clock::rep>(budget / iteration, 1, static_cast<Clock::rep>(stride_) * kMaxGrowth);
+
+    stride_ = static_cast<uint32_t>(std::min<Clock::rep>(stride, kMaxStride));
+    countdown_ = stride_;
+    last_check_ = now;
+    return false;
+}
+} // namespace utils
@@ -0,0 +1,73 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "utils/hash.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+namespace
+{
+constexpr uint64_t kMultiplier{ 0x9e3779b97f4a7c15ull };
+
+uint64_t Mix(uint64_t value) noexcept
+{
+    value ^= value >> 32;
+    value *= 0xd6e8feb86659fd93ull;
+    value ^= value >> 32;
+    return value;
+}
+} // namespace
+
+namespace utils
+{
+uint64_t Hash(const void* data, size_t size) noexcept
+{
+    const auto* bytes = static_cast<const unsigned char*>(data);
+
+    // Four independent lanes keep the multiplications of the consecutive words in flight together
+    uint64_t lanes[4]{ size, size ^ kMultiplier, ~size, size + kMultiplier };
+    size_t position{};
+    for (; position + 32 <= size; position += 32)
+    {
+        for (size_t lane{}; lane < 4; ++lane)
+        {
+            uint64_t word;
+            std::memcpy(&word, bytes + position + lane * 8, sizeof(word));
+            lanes[lane] = std::rotl(lanes[lane] ^ word, 29) * kMultiplier;
+        }
+    }
+
+    uint64_t result = lanes[0];
+    for (; position < size; position += sizeof(uint64_t))
+    {
+        uint64_t word{};
+        std::memcpy(&word, bytes + position, std::min(size - position, sizeof(word)));
+        result = Mix(result ^ word) * kMultiplier;
+    }
+
+    for (size_t lane{ 1 }; lane < 4; ++lane)
+    {
+        result = Mix(result ^ lanes[lane]) * kMultiplier;
+    }
+
+    return Mix(result);
+}
+} // namespace utils
@@ -0,0 +1,63 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+#include "utils/memory/blockpool.hpp"
+
+#include <algorithm>
+
+namespace utils::memory
+{
+BlockPool::BlockPool(size_t block_size, size_t chunk_blocks)
+    : block_size_{ (std::max(block_size, sizeof(FreeBlock)) + alignof(std::max_align_t) - 1) /
+                   alignof(std::max_align_t) * alignof(std::max_align_t) },
+      chunk_blocks_{ std::max<size_t>(chunk_blocks, 1) }
+{
+}
+
+void* BlockPool::Allocate()
+{
+    std::lock_guard lock{ mutex_ };
+    if (free_ == nullptr)
+    {
+        // The whole chunk is threaded onto the free list, so the next allocations only unlink its blocks
+        auto& chunk = chunks_.emplace_back(new std::byte[block_size_ * chunk_blocks_]);
+        for (size_t block{ chunk_blocks_ }; block > 0; --block)
+        {
+            free_ = new (chunk.get() + (block - 1) * block_size_) FreeBlock{ free_ };
+        }
+    }
+
+    auto* block = free_;
+    free_ = block->next;
+    ++used_;
+    return block;
+}
+
+void BlockPool::Deallocate(void* block) noexcept
+{
+    std::lock_guard lock{ mutex_ };
+    free_ = new (block) FreeBlock{ free_ };
+    --used_;
+}
+
+size_t BlockPool::GetUsed() const noexcept
+{
+    std::lock_guard lock{ mutex_ };
+    return used_;
+}
+} // namespace utils::memory
@@ -0,0 +1,96 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "utils/os/mappedfile.hpp"
+
+#include <stdexcept>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define UTILS_OS_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <fstream>
+#include <iterator>
+#endif
+
+namespace utils::os
+{
+#ifdef UTILS_OS_MMAP
+MappedFile::MappedFile(const std::string& path)
+{
+    const int descriptor = open(path.c_str(), O_RDONLY);
+    if (descriptor < 0)
+    {
+        throw std::runtime_error("Input file " + path + " was not opened");
+    }
+
+    struct stat status;
+    if (fstat(descriptor, &status) != 0)
+    {
+        close(descriptor);
+        throw std::runtime_error("Input file " + path + " cannot be inspected");
+    }
+
+    // An empty file cannot be mapped, so it is left as an empty view
+    size_ = static_cast<size_t>(status.st_size);
+    if (size_ != 0)
+    {
+        void* address = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, descriptor, 0);
+        if (address == MAP_FAILED)
+        {
+            close(descriptor);
+            throw std::runtime_error("Input file " + path + " cannot be mapped");
+        }
+
+        // The parsers read the file once from the beginning to the end
+        madvise(address, size_, MADV_SEQUENTIAL);
+        data_ = static_cast<const char*>(address);
+    }
+
+    // The mapping stays valid after the descriptor is closed
+    close(descriptor);
+}
+
+MappedFile::~MappedFile()
+{
+    if (data_ != nullptr)
+    {
+        munmap(const_cast<char*>(data_), size_);
+    }
+}
+#else
+MappedFile::MappedFile(const std::string& path)
+{
+    std::ifstream stream{ path, std::ios::binary };
+    if (!stream.is_open())
+    {
+        throw std::runtime_error("Input file " + path + " was not opened");
+    }
+
+    buffer_.assign(std::istreambuf_iterator<char>{ stream }, std::istreambuf_iterator<char>{});
+    data_ = buffer_.data();
+    size_ = buffer_.size();
+}
+
+MappedFile::~MappedFile() = default;
+#endif
+} // namespace utils::os
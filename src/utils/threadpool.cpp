@@ -0,0 +1,214 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "utils/threadpool.hpp"
+
+#include <algorithm>
+
+namespace
+{
+// The pool and the index of the worker running on the current thread
+thread_local const utils::ThreadPool* current_pool{};
+thread_local size_t current_worker{};
+} // namespace
+
+namespace utils
+{
+ThreadPool::ThreadPool(size_t threads) : start_{ std::chrono::steady_clock::now() }
+{
+    if (threads == 0)
+    {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    queues_.reserve(threads);
+    for (size_t index{}; index < threads; ++index)
+    {
+        queues_.push_back(std::make_unique<Worker>());
+    }
+
+    threads_.reserve(threads);
+    for (size_t index{}; index < threads; ++index)
+    {
+        threads_.emplace_back(&ThreadPool::Work, this, index);
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    Shutdown();
+}
+
+ThreadPool::Report ThreadPool::Shutdown()
+{
+    if (threads_.empty())
+    {
+        return report_;
+    }
+
+    {
+        std::lock_guard lock{ mutex_ };
+        stopped_ = true;
+    }
+    condition_.notify_all();
+
+    for (auto& thread : threads_)
+    {
+        thread.join();
+    }
+    threads_.clear();
+
+    report_.lifetime = std::chrono::steady_clock::now() - start_;
+    for (const auto& queue : queues_)
+    {
+        report_.workers.push_back(queue->statistics);
+    }
+
+    return report_;
+}
+
+void ThreadPool::Push(Task task)
+{
+    // A sub-task stays with the worker of its parent, unless another worker steals it
+    const bool is_subtask = current_pool == this;
+    if (is_subtask)
+    {
+        auto& queue = *queues_[current_worker];
+        std::lock_guard lock{ queue.mutex };
+        queue.tasks.push_back(std::move(task));
+    }
+
+    {
+        std::lock_guard lock{ mutex_ };
+        if (!is_subtask)
+        {
+            submitted_.push_back(std::move(task));
+        }
+        ++pending_;
+    }
+    condition_.notify_one();
+}
+
+ThreadPool::Task ThreadPool::TakeOwn(size_t worker)
+{
+    Task task;
+    {
+        auto& queue = *queues_[worker];
+        std::lock_guard lock{ queue.mutex };
+        if (queue.tasks.empty())
+        {
+            return task;
+        }
+
+        task = std::move(queue.tasks.back());
+        queue.tasks.pop_back();
+    }
+
+    std::lock_guard lock{ mutex_ };
+    --pending_;
+    return task;
+}
+
+ThreadPool::Task ThreadPool::Take(size_t worker)
+{
+    auto task = TakeOwn(worker);
+    if (task)
+    {
+        return task;
+    }
+
+    // The sub-tasks of the running tasks are stolen before any new task starts, so the running ones finish first
+    for (size_t offset{ 1 }; offset < queues_.size() && !task; ++offset)
+    {
+        auto& victim = *queues_[(worker + offset) % queues_.size()];
+        std::lock_guard lock{ victim.mutex };
+        if (!victim.tasks.empty())
+        {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+        }
+    }
+
+    std::lock_guard lock{ mutex_ };
+    if (task)
+    {
+        ++queues_[worker]->statistics.stolen;
+    }
+    else if (!submitted_.empty())
+    {
+        task = std::move(submitted_.front());
+        submitted_.pop_front();
+    }
+
+    if (task)
+    {
+        --pending_;
+    }
+    return task;
+}
+
+bool ThreadPool::Help()
+{
+    if (current_pool != this)
+    {
+        return false;
+    }
+
+    // Only the own sub-tasks are taken, as any other task could delay the waiting one by its whole duration. The time
+    // of the task is already counted by the task, which waits for it
+    auto task = TakeOwn(current_worker);
+    if (!task)
+    {
+        return false;
+    }
+
+    task();
+    ++queues_[current_worker]->statistics.tasks;
+    return true;
+}
+
+void ThreadPool::Work(size_t worker)
+{
+    current_pool = this;
+    current_worker = worker;
+    auto& statistics = queues_[worker]->statistics;
+
+    while (true)
+    {
+        auto task = Take(worker);
+        if (!task)
+        {
+            std::unique_lock lock{ mutex_ };
+            condition_.wait(lock, [this]() { return stopped_ || pending_ != 0; });
+
+            // Drain the queues before stopping, so no future is left without a value
+            if (pending_ == 0)
+            {
+                return;
+            }
+            continue;
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        task();
+        statistics.busy += std::chrono::steady_clock::now() - start;
+        ++statistics.tasks;
+    }
+}
+} // namespace utils
@@ -19,29 +19,56 @@
 
 #include "utils/tokenizer.hpp"
 
-#include <iostream>
-#include <regex>
-
 namespace utils
 {
-Tokenizer::Tokens Tokenizer::tokenize(std::string line, char delimiter)
+void Tokenizer::Iterator::Advance() noexcept
 {
-    Tokens tokens;
-    size_t position;
-
-    std::regex space_re(R"(\s+)");
-    line = std::regex_replace(line, space_re, " ");
+    const bool whitespace = IsWhitespace(delimiter_);
+    const auto is_separator = [this, whitespace](char value) {
+        return value == delimiter_ || (whitespace && IsWhitespace(value));
+    };
 
-    while ((position = line.find(delimiter)) != std::string::npos)
+    while (true)
     {
-        auto token = line.substr(0, position);
-        if (!token.empty())
-            tokens.push_back(token);
+        size_t start{};
+        while (start < rest_.size() && (is_separator(rest_[start]) || IsWhitespace(rest_[start])))
+        {
+            ++start;
+        }
+
+        if (start == rest_.size())
+        {
+            token_ = {};
+            rest_ = {};
+            return;
+        }
 
-        line.erase(0, position + 1);
+        size_t end{ start };
+        while (end < rest_.size() && !is_separator(rest_[end]))
+        {
+            ++end;
+        }
+
+        token_ = Trim(rest_.substr(start, end - start));
+        rest_.remove_prefix(end);
+        if (!token_.empty())
+        {
+            return;
+        }
+    }
+}
+
+std::string_view Tokenizer::Trim(std::string_view value) noexcept
+{
+    while (!value.empty() && IsWhitespace(value.front()))
+    {
+        value.remove_prefix(1);
+    }
+    while (!value.empty() && IsWhitespace(value.back()))
+    {
+        value.remove_suffix(1);
     }
-    tokens.push_back(line);
 
-    return tokens;
+    return value;
 }
-} // namespace utils
\ No newline at end of file
+} // namespace utils
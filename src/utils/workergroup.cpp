@@ -0,0 +1,149 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "utils/workergroup.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace
+{
+/**
+ * @brief The amount of checks of a flag before the thread goes to sleep
+ */
+constexpr size_t kSpinCount{ 4096 };
+
+template <class T> void WaitWhileEqual(const std::atomic<T>& value, T old)
+{
+    for (size_t spin{}; spin < kSpinCount; ++spin)
+    {
+        if (value.load(std::memory_order_acquire) != old)
+        {
+            return;
+        }
+    }
+
+    while (value.load(std::memory_order_acquire) == old)
+    {
+        value.wait(old, std::memory_order_acquire);
+    }
+}
+} // namespace
+
+namespace utils
+{
+WorkerGroup::WorkerGroup(size_t size)
+{
+    if (size == 0)
+    {
+        size = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    threads_.reserve(size - 1);
+    for (size_t worker{ 1 }; worker < size; ++worker)
+    {
+        threads_.emplace_back(&WorkerGroup::Work, this, worker);
+    }
+}
+
+WorkerGroup::~WorkerGroup()
+{
+    stopped_.store(true, std::memory_order_release);
+    generation_.fetch_add(1, std::memory_order_acq_rel);
+    generation_.notify_all();
+
+    for (auto& thread : threads_)
+    {
+        thread.join();
+    }
+}
+
+void WorkerGroup::Run(const Job& job)
+{
+    if (threads_.empty())
+    {
+        job(0);
+        return;
+    }
+
+    job_ = &job;
+    pending_.store(threads_.size(), std::memory_order_relaxed);
+    generation_.fetch_add(1, std::memory_order_acq_rel);
+    generation_.notify_all();
+
+    try
+    {
+        job(0);
+    }
+    catch (...)
+    {
+        Capture();
+    }
+
+    // Wait for the other workers to finish, as the job may refer to the state of the caller
+    size_t pending;
+    while ((pending = pending_.load(std::memory_order_acquire)) != 0)
+    {
+        WaitWhileEqual(pending_, pending);
+    }
+
+    if (error_ != nullptr)
+    {
+        std::rethrow_exception(std::exchange(error_, nullptr));
+    }
+}
+
+void WorkerGroup::Capture() noexcept
+{
+    std::lock_guard lock{ error_mutex_ };
+    if (error_ == nullptr)
+    {
+        error_ = std::current_exception();
+    }
+}
+
+void WorkerGroup::Work(size_t worker)
+{
+    uint64_t generation{};
+    while (true)
+    {
+        WaitWhileEqual(generation_, generation);
+        generation = generation_.load(std::memory_order_acquire);
+
+        if (stopped_.load(std::memory_order_acquire))
+        {
+            return;
+        }
+
+        try
+        {
+            (*job_)(worker);
+        }
+        catch (...)
+        {
+            Capture();
+        }
+
+        if (pending_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            pending_.notify_one();
+        }
+    }
+}
+} // namespace utils
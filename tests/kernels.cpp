@@ -0,0 +1,255 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "tsp/distances.hpp"
+#include "tsp/kernels.hpp"
+
+/**
+ * @brief Compares every vectorised kernel with the generic scalar one on random tours of the dense distances
+ *
+ * The sizes are not multiples of the vector widths, so the tails of the blocks are covered as well. The program
+ * returns a non-zero code if any result differs.
+ */
+namespace
+{
+using tsp::kernels::Level;
+
+// The sizes of the tours, which leave a tail after every vector width
+constexpr size_t kSizes[]{ 5, 7, 13, 17, 31, 37, 70, 131 };
+
+// The amount of the random tours per size
+constexpr size_t kTours{ 4 };
+
+const std::pair<Level, const char*> kLevels[]{
+    { Level::kScalar, "scalar" }, { Level::kSse4, "sse4" }, { Level::kAvx2, "avx2" }, { Level::kAvx512, "avx512" }
+};
+
+size_t failures{};
+
+/**
+ * @brief The dense distances hidden behind a different type, so the calls resolve to the generic kernels
+ */
+template <class T> struct Generic
+{
+    const tsp::DenseDistances<T>& distances;
+
+    uint32_t operator()(uint32_t from, uint32_t to) const noexcept
+    {
+        return distances(from, to);
+    }
+
+    size_t Size() const noexcept
+    {
+        return distances.Size();
+    }
+};
+
+template <class Value> void Expect(const std::string& context, const Value& expected, const Value& actual)
+{
+    if (expected != actual)
+    {
+        std::cerr << "FAILED " << context << std::endl;
+        ++failures;
+    }
+}
+
+template <class T> tsp::DenseDistances<T> MakeDistances(size_t size, std::mt19937_64& random)
+{
+    math::Matrix<T> matrix{ static_cast<uint32_t>(size), static_cast<uint32_t>(size) };
+    // The offset is large, so the sums are checked beyond the range of the stored type, but the distances fit 32 bits
+    constexpr uint32_t kOffset{ 1000 };
+    const uint32_t largest = std::numeric_limits<T>::max() - (sizeof(T) == sizeof(uint32_t) ? kOffset : 0);
+    std::uniform_int_distribution<uint32_t> value{ 0, largest };
+    for (uint32_t row{}; row < size; ++row)
+    {
+        for (uint32_t column{}; column < size; ++column)
+        {
+            matrix(row, column) = row == column ? 0 : static_cast<T>(value(random));
+        }
+    }
+
+    return tsp::DenseDistances<T>{ std::move(matrix), kOffset };
+}
+
+/**
+ * @brief Check every kernel on a single tour against the generic ones
+ */
+template <class T>
+void CheckTour(const std::string& name, const tsp::DenseDistances<T>& distances, const std::vector<uint32_t>& tour)
+{
+    const Generic<T> generic{ distances };
+    const auto size = tour.size();
+    const auto context = [&name, size](const char* kernel, size_t i = 0, size_t first = 0) {
+        return name + " " + kernel + " size " + std::to_string(size) + " i " + std::to_string(i) + " first " +
+               std::to_string(first);
+    };
+
+    Expect(context("TourLength"), tsp::kernels::TourLength(generic, tour.data(), size),
+           tsp::kernels::TourLength(distances, tour.data(), size));
+
+    std::vector<uint32_t> forward(size);
+    std::vector<uint32_t> backward(size);
+    std::vector<uint32_t> expected_forward(size);
+    std::vector<uint32_t> expected_backward(size);
+    tsp::kernels::TourEdges(generic, tour.data(), size, expected_forward.data(), expected_backward.data());
+    tsp::kernels::TourEdges(distances, tour.data(), size, forward.data(), backward.data());
+    Expect(context("TourEdges forward"), expected_forward, forward);
+    Expect(context("TourEdges backward"), expected_backward, backward);
+
+    // The sums of the edges before every position, as kept by the 2-opt
+    std::vector<int64_t> forward_sums(size + 1);
+    std::vector<int64_t> backward_sums(size + 1);
+    for (size_t position{ 1 }; position <= size; ++position)
+    {
+        forward_sums[position] = forward_sums[position - 1] + forward[position - 1];
+        backward_sums[position] = backward_sums[position - 1] + backward[position - 1];
+    }
+
+    std::vector<int64_t> expected(tsp::kernels::kBlockSize);
+    std::vector<int64_t> actual(tsp::kernels::kBlockSize);
+    const auto check = [&](const char* kernel, size_t i, size_t first, size_t count, const auto& calculate) {
+        calculate(generic, expected.data());
+        calculate(distances, actual.data());
+        for (size_t k{}; k < count; ++k)
+        {
+            Expect(context(kernel, i, first + k), expected[k], actual[k]);
+        }
+    };
+
+    for (size_t i{ 1 }; i + 1 < size; ++i)
+    {
+        // The blocks start right after the first valid position and run up to the end of the tour
+        for (size_t first{ i + 2 }; first + 1 < size; first += tsp::kernels::kBlockSize)
+        {
+            const auto count = std::min(tsp::kernels::kBlockSize, size - 1 - first);
+            check("SwapDeltas", i, first, count, [&](const auto& values, int64_t* deltas) {
+                tsp::kernels::SwapDeltas(values, tour.data(), forward.data(), i, first, count, deltas);
+            });
+        }
+
+        for (size_t first{ i + 1 }; first + 1 < size; first += tsp::kernels::kBlockSize)
+        {
+            const auto count = std::min(tsp::kernels::kBlockSize, size - 1 - first);
+            check("ReversalDeltas", i, first, count, [&](const auto& values, int64_t* deltas) {
+                tsp::kernels::ReversalDeltas(values, tour.data(), forward.data(), forward_sums.data(),
+                                             backward_sums.data(), i, first, count, deltas);
+            });
+        }
+
+        for (size_t length{ 1 }; length <= 3 && i + length < size; ++length)
+        {
+            // The segment is inserted after the positions behind it and before the position directly preceding it
+            const auto insert = [&](size_t first, size_t end) {
+                for (; first < end; first += tsp::kernels::kBlockSize)
+                {
+                    const auto count = std::min(tsp::kernels::kBlockSize, end - first);
+                    check("InsertionDeltas", i, first, count, [&](const auto& values, int64_t* deltas) {
+                        tsp::kernels::InsertionDeltas(values, tour.data(), forward.data(), i, length, first, count,
+                                                      deltas);
+                    });
+                }
+            };
+            insert(0, i - 1);
+            insert(i + length, size - 1);
+        }
+    }
+}
+
+template <class T> void CheckType(const std::string& type, std::mt19937_64& random)
+{
+    for (const auto size : kSizes)
+    {
+        const auto distances = MakeDistances<T>(size, random);
+        std::vector<uint32_t> tour(size);
+        for (size_t repeat{}; repeat < kTours; ++repeat)
+        {
+            std::iota(tour.begin(), tour.end(), 0);
+            std::shuffle(tour.begin(), tour.end(), random);
+            for (const auto& [level, name] : kLevels)
+            {
+                tsp::kernels::SetLevel(level);
+                if (tsp::kernels::GetLevel() == level)
+                {
+                    CheckTour(type + " " + name, distances, tour);
+                }
+            }
+        }
+    }
+}
+
+template <class T> void CheckMinPlus(const std::string& type, std::mt19937_64& random)
+{
+    std::uniform_int_distribution<uint32_t> value{ 0, std::numeric_limits<T>::max() / 2 };
+    for (const auto size : kSizes)
+    {
+        std::vector<T> first(size);
+        std::vector<T> second(size);
+        std::generate(first.begin(), first.end(), [&] { return static_cast<T>(value(random)); });
+        std::generate(second.begin(), second.end(), [&] { return static_cast<T>(value(random)); });
+
+        T expected{ std::numeric_limits<T>::max() };
+        for (size_t k{}; k < size; ++k)
+        {
+            expected = std::min<T>(expected, first[k] + second[k]);
+        }
+
+        for (const auto& [level, name] : kLevels)
+        {
+            tsp::kernels::SetLevel(level);
+            if (tsp::kernels::GetLevel() == level)
+            {
+                Expect(type + " " + name + " MinPlus size " + std::to_string(size), expected,
+                       tsp::kernels::GetMinPlus<T>()(first.data(), second.data(), size));
+            }
+        }
+    }
+}
+} // namespace
+
+int main()
+{
+    std::mt19937_64 random{ 2023 };
+    CheckType<uint8_t>("u8", random);
+    CheckType<uint16_t>("u16", random);
+    CheckType<uint32_t>("u32", random);
+    CheckMinPlus<uint16_t>("u16", random);
+    CheckMinPlus<uint32_t>("u32", random);
+
+    // Report the levels, which this processor could not check
+    for (const auto& [level, name] : kLevels)
+    {
+        tsp::kernels::SetLevel(level);
+        if (tsp::kernels::GetLevel() != level)
+        {
+            std::cout << "Skipped " << name << ", it is not supported by the processor" << std::endl;
+        }
+    }
+
+    std::cout << (failures == 0 ? "All kernels match" : std::to_string(failures) + " mismatches") << std::endl;
+    return failures == 0 ? 0 : 1;
+}